@@ -0,0 +1,128 @@
+// File: src/AllPairsShortestPaths.cpp
+#include "AllPairsShortestPaths.h"
+#include <algorithm>
+#include <limits>
+#include "DijkstraWorkspace.h"
+#include "ParallelExecutor.h"
+
+namespace {
+    const int INF = std::numeric_limits<int>::max();
+    // Entries stay within [-BLOCKED_INF, BLOCKED_INF], so the sum of two
+    // still fits in an int
+    const int BLOCKED_INF = INF / 2;
+
+    // c[i][j] = min(c[i][j], a[i][k] + b[k][j]) over one block. a or b may
+    // alias c: with k outermost this is exactly the Floyd-Warshall update.
+    // Row k of b is copied to a local buffer so the inner loop provably does
+    // not alias and vectorizes without runtime overlap checks. Infinite
+    // operands never relax anything, so a negative weight cannot pull an
+    // unreachable entry below BLOCKED_INF; the lower clamp only matters once
+    // a negative cycle keeps shrinking its entries.
+    void minPlusBlock(int* c, const int* a, const int* b, size_t stride) {
+        const size_t n = AllPairsShortestPaths::BLOCK_SIZE;
+        int bRow[AllPairsShortestPaths::BLOCK_SIZE];
+        for (size_t k = 0; k < n; k++) {
+            std::copy(b + k * stride, b + k * stride + n, bRow);
+            for (size_t i = 0; i < n; i++) {
+                const int aik = a[i * stride + k];
+                if (aik >= BLOCKED_INF) continue;
+                int* cRow = c + i * stride;
+                for (size_t j = 0; j < n; j++) {
+                    const int through = bRow[j] >= BLOCKED_INF ? BLOCKED_INF : aik + bRow[j];
+                    cRow[j] = std::max(std::min(cRow[j], through), -BLOCKED_INF);
+                }
+            }
+        }
+    }
+}
+
+double AllPairsShortestPaths::density(const CSRGraph& graph) {
+    const double vertices = graph.numVertices();
+    if (vertices < 2) return 1.0;
+    return static_cast<double>(graph.numEdges()) / (vertices * (vertices - 1));
+}
+
+AllPairsShortestPaths::Result AllPairsShortestPaths::floydWarshall(const CSRGraph& graph) {
+    const size_t vertexCount = static_cast<size_t>(graph.numVertices());
+    const size_t blocks = (vertexCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const size_t stride = blocks * BLOCK_SIZE;
+
+    // Padding rows and columns stay at infinity and never shorten a path
+    std::vector<int> padded(stride * stride, BLOCKED_INF);
+    for (size_t v = 0; v < vertexCount; v++) {
+        padded[v * stride + v] = 0;
+        for (auto e = graph.edgeBegin(static_cast<int>(v)); e < graph.edgeEnd(static_cast<int>(v)); ++e) {
+            int& cell = padded[v * stride + graph.target(e)];
+            cell = std::max(std::min(cell, graph.weight(e)), -BLOCKED_INF);
+        }
+    }
+
+    auto block = [&](size_t row, size_t column) {
+        return padded.data() + row * BLOCK_SIZE * stride + column * BLOCK_SIZE;
+    };
+
+    for (size_t k = 0; k < blocks; k++) {
+        int* diagonal = block(k, k);
+        minPlusBlock(diagonal, diagonal, diagonal, stride);
+
+        // Row k and column k blocks depend only on the diagonal block
+        ParallelExecutor::forEachChunk(2 * blocks, 1, [&](size_t first, size_t last, unsigned) {
+            for (size_t t = first; t < last; t++) {
+                size_t other = t % blocks;
+                if (other == k) continue;
+                if (t < blocks) {
+                    int* rowBlock = block(k, other);
+                    minPlusBlock(rowBlock, diagonal, rowBlock, stride);
+                }
+                else {
+                    int* columnBlock = block(other, k);
+                    minPlusBlock(columnBlock, columnBlock, diagonal, stride);
+                }
+            }
+        });
+
+        // Every other block combines its row's and column's pivot blocks
+        ParallelExecutor::forEachChunk(blocks * blocks, 1, [&](size_t first, size_t last, unsigned) {
+            for (size_t t = first; t < last; t++) {
+                size_t i = t / blocks;
+                size_t j = t % blocks;
+                if (i == k || j == k) continue;
+                minPlusBlock(block(i, j), block(i, k), block(k, j), stride);
+            }
+        });
+    }
+
+    Result result;
+    for (size_t v = 0; v < vertexCount && !result.negativeCycle; v++) {
+        result.negativeCycle = padded[v * stride + v] < 0;
+    }
+
+    result.distances.resize(vertexCount * vertexCount);
+    ParallelExecutor::forEachChunk(vertexCount, 64, [&](size_t first, size_t last, unsigned) {
+        for (size_t i = first; i < last; i++) {
+            for (size_t j = 0; j < vertexCount; j++) {
+                int value = padded[i * stride + j];
+                result.distances[i * vertexCount + j] = value >= BLOCKED_INF ? INF : value;
+            }
+        }
+    });
+    return result;
+}
+
+std::vector<int> AllPairsShortestPaths::repeatedDijkstra(const CSRGraph& graph) {
+    const size_t vertexCount = static_cast<size_t>(graph.numVertices());
+    std::vector<int> distances(vertexCount * vertexCount);
+    std::vector<DijkstraWorkspace> workspaces(ParallelExecutor::threadCount());
+
+    ParallelExecutor::forEachChunk(vertexCount, 1, [&](size_t first, size_t last, unsigned thread) {
+        DijkstraWorkspace& workspace = workspaces[thread];
+        for (size_t source = first; source < last; source++) {
+            workspace.run(graph, static_cast<int>(source), -1);
+            int* row = distances.data() + source * vertexCount;
+            for (size_t v = 0; v < vertexCount; v++) {
+                row[v] = workspace.getDistance(static_cast<int>(v));
+            }
+        }
+    });
+    return distances;
+}
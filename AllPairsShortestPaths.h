@@ -0,0 +1,43 @@
+// File: include/AllPairsShortestPaths.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+
+// All-pairs shortest path distances as a row-major vertexCount x vertexCount
+// matrix in dense vertex order, INT_MAX where unreachable.
+//
+// Dense graphs use a cache-blocked Floyd-Warshall: each round relaxes the
+// diagonal block, then its row and column blocks, then every remaining block,
+// with the last two phases spread over the worker pool. The min-plus inner
+// loop runs over contiguous rows with no branches, so the compiler vectorizes
+// it. Sparse graphs are faster with one Dijkstra search per source, run in
+// parallel with a workspace per thread.
+class AllPairsShortestPaths {
+public:
+    // Edge density (edges / possible edges) at which Floyd-Warshall wins
+    static constexpr double DENSITY_THRESHOLD = 0.1;
+    // Block edge length; three blocks of ints fit comfortably in L2
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    static double density(const CSRGraph& graph);
+    // Dense graphs, and graphs with negative weights that Dijkstra cannot handle
+    static bool preferFloydWarshall(const CSRGraph& graph) {
+        return graph.minWeight() < 0 || density(graph) >= DENSITY_THRESHOLD;
+    }
+
+    struct Result {
+        std::vector<int> distances;
+        // Some vertex lies on a negative cycle; distances between pairs that
+        // can route through it are then not shortest path lengths
+        bool negativeCycle = false;
+    };
+
+    // Handles negative weights. Distances of magnitude 2^30 or more are not
+    // representable in this mode, since the padded matrix uses INT_MAX / 2 as
+    // its overflow-free infinity.
+    static Result floydWarshall(const CSRGraph& graph);
+    // Requires non-negative weights
+    static std::vector<int> repeatedDijkstra(const CSRGraph& graph);
+};
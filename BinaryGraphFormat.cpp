@@ -0,0 +1,219 @@
+// File: src/BinaryGraphFormat.cpp
+#include "BinaryGraphFormat.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include "MappedFile.h"
+#include "ParallelExecutor.h"
+
+namespace {
+    const char MAGIC[8] = { 'G', 'A', 'T', 'C', 'S', 'R', '\0', '\0' };
+    const std::uint32_t ENDIANNESS_MARKER = 0x01020304;
+
+    enum Section {
+        OFFSETS, TARGETS, WEIGHTS, REVERSE_OFFSETS, SOURCES, REVERSE_WEIGHTS,
+        EXTERNAL_IDS, SORTED_IDS, SORTED_INDEX, SECTION_COUNT
+    };
+
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t endianness;
+        std::int64_t vertexCount;
+        std::uint64_t edgeCount;
+        std::uint64_t fileSize;
+        // Byte offset of each section from the start of the file, 0 if absent
+        std::uint64_t sectionOffsets[SECTION_COUNT];
+    };
+
+    std::uint64_t alignUp(std::uint64_t value) {
+        return (value + 7) & ~std::uint64_t(7);
+    }
+
+    // Byte size of one element of each section
+    std::uint64_t elementSize(int section) {
+        switch (section) {
+        case OFFSETS:
+        case REVERSE_OFFSETS:
+            return sizeof(CSRGraph::EdgeIndex);
+        case EXTERNAL_IDS:
+        case SORTED_IDS:
+            return sizeof(NodeId);
+        default:
+            return sizeof(int);
+        }
+    }
+
+    // Number of elements in each section for the given counts
+    std::uint64_t elementCount(int section, std::uint64_t vertices, std::uint64_t edges) {
+        switch (section) {
+        case OFFSETS:
+        case REVERSE_OFFSETS:
+            return vertices + 1;
+        case TARGETS:
+        case WEIGHTS:
+        case SOURCES:
+        case REVERSE_WEIGHTS:
+            return edges;
+        default:
+            return vertices;
+        }
+    }
+
+    // Expected byte length of each section for the given counts
+    std::uint64_t sectionSize(int section, std::uint64_t vertices, std::uint64_t edges) {
+        return elementCount(section, vertices, edges) * elementSize(section);
+    }
+
+    // Whether the section fits in available bytes; divides instead of
+    // multiplying so corrupt counts cannot wrap around
+    bool sectionFits(int section, std::uint64_t vertices, std::uint64_t edges, std::uint64_t available) {
+        return elementCount(section, vertices, edges) <= available / elementSize(section);
+    }
+
+    // Offsets must start at 0, never decrease and end at the edge count
+    bool offsetsValid(const CSRGraph::EdgeIndex* offsets, std::uint64_t vertices, std::uint64_t edges) {
+        if (offsets[0] != 0 || offsets[vertices] != edges) return false;
+        for (std::uint64_t v = 0; v < vertices; v++) {
+            if (offsets[v] > offsets[v + 1]) return false;
+        }
+        return true;
+    }
+
+    // Every value in [0, limit)
+    bool indicesInRange(const int* values, std::uint64_t count, int limit) {
+        std::atomic<bool> valid(true);
+        ParallelExecutor::forEachChunk(count, 1 << 20, [&](size_t first, size_t last, unsigned) {
+            for (size_t i = first; i < last; i++) {
+                if (values[i] < 0 || values[i] >= limit) {
+                    valid.store(false, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+        return valid.load(std::memory_order_relaxed);
+    }
+}
+
+void BinaryGraphFormat::write(const CSRGraph& graph, const std::string& filename) {
+    const CSRGraph::Arrays& arrays = graph.arrays();
+    const std::uint64_t vertices = static_cast<std::uint64_t>(arrays.vertexCount);
+    const std::uint64_t edges = arrays.edgeCount;
+
+    const void* sections[SECTION_COUNT] = {
+        arrays.offsets, arrays.targets, arrays.weights,
+        arrays.reverseOffsets, arrays.sources, arrays.reverseWeights,
+        arrays.externalIds, arrays.sortedIds, arrays.sortedIndex
+    };
+
+    FileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.endianness = ENDIANNESS_MARKER;
+    header.vertexCount = arrays.vertexCount;
+    header.edgeCount = edges;
+
+    std::uint64_t position = alignUp(sizeof(FileHeader));
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        if (!sections[s]) continue;
+        header.sectionOffsets[s] = position;
+        position = alignUp(position + sectionSize(s, vertices, edges));
+    }
+    header.fileSize = position;
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot create graph file: " + filename);
+    }
+
+    const char padding[8] = {};
+    std::uint64_t written = 0;
+    auto writeBytes = [&](const void* bytes, std::uint64_t count) {
+        out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+        written += count;
+    };
+
+    writeBytes(&header, sizeof(header));
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        if (!sections[s]) continue;
+        writeBytes(padding, header.sectionOffsets[s] - written);
+        writeBytes(sections[s], sectionSize(s, vertices, edges));
+    }
+    writeBytes(padding, header.fileSize - written);
+
+    if (!out) {
+        throw std::runtime_error("Failed writing graph file: " + filename);
+    }
+}
+
+std::shared_ptr<const CSRGraph> BinaryGraphFormat::open(const std::string& filename) {
+    auto file = std::make_shared<MappedFile>(filename);
+    const char* base = file->data();
+
+    FileHeader header;
+    if (!base || file->size() < sizeof(FileHeader)) {
+        throw std::runtime_error("Truncated graph file: " + filename);
+    }
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a graph file: " + filename);
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported graph file version " +
+            std::to_string(header.version) + ": " + filename);
+    }
+    if (header.endianness != ENDIANNESS_MARKER) {
+        throw std::runtime_error("Graph file has foreign byte order: " + filename);
+    }
+    if (header.vertexCount < 0 || header.vertexCount > std::numeric_limits<int>::max() ||
+        header.fileSize != file->size() || header.edgeCount > header.fileSize / sizeof(int)) {
+        throw std::runtime_error("Corrupt graph file header: " + filename);
+    }
+
+    const std::uint64_t vertices = static_cast<std::uint64_t>(header.vertexCount);
+    const char* sections[SECTION_COUNT] = {};
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        std::uint64_t offset = header.sectionOffsets[s];
+        if (offset == 0) continue;
+        if (offset % 8 != 0 || offset > header.fileSize ||
+            !sectionFits(s, vertices, header.edgeCount, header.fileSize - offset)) {
+            throw std::runtime_error("Corrupt graph file section table: " + filename);
+        }
+        sections[s] = base + offset;
+    }
+    for (int s = OFFSETS; s <= EXTERNAL_IDS; s++) {
+        if (!sections[s]) {
+            throw std::runtime_error("Graph file is missing required sections: " + filename);
+        }
+    }
+    if (!sections[SORTED_IDS] != !sections[SORTED_INDEX]) {
+        throw std::runtime_error("Graph file has an incomplete ID index: " + filename);
+    }
+
+    CSRGraph::Arrays arrays;
+    arrays.vertexCount = static_cast<int>(header.vertexCount);
+    arrays.edgeCount = header.edgeCount;
+    arrays.offsets = reinterpret_cast<const CSRGraph::EdgeIndex*>(sections[OFFSETS]);
+    arrays.targets = reinterpret_cast<const int*>(sections[TARGETS]);
+    arrays.weights = reinterpret_cast<const int*>(sections[WEIGHTS]);
+    arrays.reverseOffsets = reinterpret_cast<const CSRGraph::EdgeIndex*>(sections[REVERSE_OFFSETS]);
+    arrays.sources = reinterpret_cast<const int*>(sections[SOURCES]);
+    arrays.reverseWeights = reinterpret_cast<const int*>(sections[REVERSE_WEIGHTS]);
+    arrays.externalIds = reinterpret_cast<const NodeId*>(sections[EXTERNAL_IDS]);
+    arrays.sortedIds = reinterpret_cast<const NodeId*>(sections[SORTED_IDS]);
+    arrays.sortedIndex = reinterpret_cast<const int*>(sections[SORTED_INDEX]);
+
+    if (!offsetsValid(arrays.offsets, vertices, header.edgeCount) ||
+        !offsetsValid(arrays.reverseOffsets, vertices, header.edgeCount)) {
+        throw std::runtime_error("Graph file has invalid edge offsets: " + filename);
+    }
+    if (!indicesInRange(arrays.targets, header.edgeCount, arrays.vertexCount) ||
+        !indicesInRange(arrays.sources, header.edgeCount, arrays.vertexCount) ||
+        (arrays.sortedIndex && !indicesInRange(arrays.sortedIndex, vertices, arrays.vertexCount))) {
+        throw std::runtime_error("Graph file references a vertex out of range: " + filename);
+    }
+
+    return std::make_shared<const CSRGraph>(arrays, std::move(file));
+}
@@ -0,0 +1,27 @@
+// File: include/BinaryGraphFormat.h
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "CSRGraph.h"
+
+// Versioned on-disk image of a CSRGraph. The file is a fixed header followed
+// by 8-byte aligned sections holding the CSR arrays exactly as they are laid
+// out in memory, so open() can map the file and use it without parsing.
+//
+// Layout: header | offsets | targets | weights | reverseOffsets | sources |
+//         reverseWeights | externalIds | sortedIds | sortedIndex
+// Integers are stored in host byte order; the header records an endianness
+// marker and open() rejects files written with a different one.
+class BinaryGraphFormat {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    static void write(const CSRGraph& graph, const std::string& filename);
+    // Maps filename read-only; the returned snapshot keeps the mapping alive.
+    // Offsets and every stored vertex index are checked once here, so queries
+    // never read out of bounds. Throws std::runtime_error if the file is
+    // missing or malformed.
+    static std::shared_ptr<const CSRGraph> open(const std::string& filename);
+};
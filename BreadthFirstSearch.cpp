@@ -0,0 +1,151 @@
+// File: src/BreadthFirstSearch.cpp
+#include "BreadthFirstSearch.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include "ParallelExecutor.h"
+
+namespace {
+    const size_t WORD_BITS = 64;
+    const size_t GRAIN = 1024;
+
+    using ParentArray = std::unique_ptr<std::atomic<int>[]>;
+
+    // Expands the queue one level; returns the summed out-degree of the
+    // newly discovered vertices
+    size_t topDownStep(const CSRGraph& graph, std::vector<int>& queue, std::vector<int>& next,
+        ParentArray& parent, std::vector<int>& depth, int level) {
+        const unsigned threads = ParallelExecutor::threadCount();
+        std::vector<std::vector<int>> discovered(threads);
+        std::vector<size_t> scout(threads, 0);
+
+        ParallelExecutor::forEachChunk(queue.size(), GRAIN / 16, [&](size_t first, size_t last, unsigned thread) {
+            for (size_t i = first; i < last; i++) {
+                int vertex = queue[i];
+                for (auto e = graph.edgeBegin(vertex), end = graph.edgeEnd(vertex); e < end; ++e) {
+                    int child = graph.target(e);
+                    int expected = -1;
+                    if (parent[child].load(std::memory_order_relaxed) == -1 &&
+                        parent[child].compare_exchange_strong(expected, vertex, std::memory_order_relaxed)) {
+                        depth[child] = level;
+                        discovered[thread].push_back(child);
+                        scout[thread] += graph.degree(child);
+                    }
+                }
+            }
+        });
+
+        next.clear();
+        size_t scoutCount = 0;
+        for (unsigned t = 0; t < threads; t++) {
+            next.insert(next.end(), discovered[t].begin(), discovered[t].end());
+            scoutCount += scout[t];
+        }
+        return scoutCount;
+    }
+
+    // Finds a frontier parent for every unvisited vertex; returns how many
+    // vertices joined the next frontier
+    size_t bottomUpStep(const CSRGraph& graph, const std::vector<std::uint64_t>& frontier,
+        std::vector<std::uint64_t>& next, ParentArray& parent, std::vector<int>& depth, int level) {
+        const size_t vertexCount = static_cast<size_t>(graph.numVertices());
+        std::vector<size_t> awake(ParallelExecutor::threadCount(), 0);
+
+        ParallelExecutor::forEachChunk(next.size(), GRAIN / WORD_BITS, [&](size_t first, size_t last, unsigned thread) {
+            for (size_t word = first; word < last; word++) {
+                std::uint64_t bits = 0;
+                const size_t end = std::min(vertexCount, (word + 1) * WORD_BITS);
+                for (size_t v = word * WORD_BITS; v < end; v++) {
+                    if (parent[v].load(std::memory_order_relaxed) != -1) continue;
+                    const int vertex = static_cast<int>(v);
+                    for (auto e = graph.inEdgeBegin(vertex), stop = graph.inEdgeEnd(vertex); e < stop; ++e) {
+                        int candidate = graph.source(e);
+                        if (frontier[candidate / WORD_BITS] >> (candidate % WORD_BITS) & 1) {
+                            parent[v].store(candidate, std::memory_order_relaxed);
+                            depth[v] = level;
+                            bits |= std::uint64_t(1) << (v % WORD_BITS);
+                            awake[thread]++;
+                            break;
+                        }
+                    }
+                }
+                next[word] = bits;
+            }
+        });
+
+        size_t total = 0;
+        for (size_t count : awake) total += count;
+        return total;
+    }
+}
+
+BreadthFirstSearch::Result BreadthFirstSearch::run(const CSRGraph& graph, int source) {
+    const int vertexCount = graph.numVertices();
+    Result result;
+    result.depth.assign(vertexCount, -1);
+    result.parent.assign(vertexCount, -1);
+    if (source < 0 || source >= vertexCount) return result;
+
+    // -1 marks unvisited; the source is its own parent during the search
+    ParentArray parent(new std::atomic<int>[vertexCount]);
+    ParallelExecutor::forEachChunk(vertexCount, 1 << 16, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            parent[v].store(-1, std::memory_order_relaxed);
+        }
+    });
+    parent[source].store(source, std::memory_order_relaxed);
+    result.depth[source] = 0;
+    result.levelSizes.push_back(1);
+
+    const size_t words = (static_cast<size_t>(vertexCount) + WORD_BITS - 1) / WORD_BITS;
+    std::vector<std::uint64_t> frontierBits(words);
+    std::vector<std::uint64_t> nextBits(words);
+    std::vector<int> queue = { source };
+    std::vector<int> next;
+
+    size_t edgesToCheck = graph.numEdges();
+    size_t scoutCount = graph.degree(source);
+    int level = 0;
+
+    while (!queue.empty()) {
+        if (scoutCount > edgesToCheck / ALPHA) {
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (int vertex : queue) {
+                frontierBits[vertex / WORD_BITS] |= std::uint64_t(1) << (vertex % WORD_BITS);
+            }
+
+            size_t awake = queue.size();
+            size_t previous;
+            do {
+                previous = awake;
+                awake = bottomUpStep(graph, frontierBits, nextBits, parent, result.depth, ++level);
+                frontierBits.swap(nextBits);
+                result.bottomUpSteps++;
+                if (awake > 0) result.levelSizes.push_back(awake);
+            } while (awake > 0 && (awake >= previous || awake > static_cast<size_t>(vertexCount) / BETA));
+
+            queue.clear();
+            for (size_t word = 0; word < words; word++) {
+                const std::uint64_t bits = frontierBits[word];
+                if (bits == 0) continue;
+                for (size_t bit = 0; bit < WORD_BITS; bit++) {
+                    if (bits >> bit & 1) queue.push_back(static_cast<int>(word * WORD_BITS + bit));
+                }
+            }
+            scoutCount = 1;
+        }
+        else {
+            edgesToCheck -= std::min(edgesToCheck, scoutCount);
+            scoutCount = topDownStep(graph, queue, next, parent, result.depth, ++level);
+            queue.swap(next);
+            result.topDownSteps++;
+            if (!queue.empty()) result.levelSizes.push_back(queue.size());
+        }
+    }
+
+    for (int v = 0; v < vertexCount; v++) {
+        result.parent[v] = parent[v].load(std::memory_order_relaxed);
+    }
+    result.parent[source] = -1;
+    return result;
+}
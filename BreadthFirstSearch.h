@@ -0,0 +1,33 @@
+// File: include/BreadthFirstSearch.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CSRGraph.h"
+
+// Direction-optimizing breadth-first search (Beamer et al.). Small frontiers
+// are expanded top-down from a vertex queue, claiming children with atomic
+// compare-and-swap. Once the frontier's out-edges outnumber the edges left to
+// explore by ALPHA, the search switches to bottom-up: every unvisited vertex
+// scans its in-edges for a parent in the frontier bitmap and stops at the
+// first hit, which skips most edges on low-diameter graphs. It switches back
+// when the frontier shrinks below vertices / BETA. Both directions run on the
+// worker pool; bottom-up threads own whole bitmap words, so no atomics are
+// needed there.
+class BreadthFirstSearch {
+public:
+    static constexpr size_t ALPHA = 15;
+    static constexpr size_t BETA = 18;
+
+    struct Result {
+        std::vector<int> depth;         // Hop distance, -1 if unreachable
+        std::vector<int> parent;        // BFS tree parent, -1 for the source and unreachable vertices
+        std::vector<size_t> levelSizes; // Vertices discovered at each depth
+        size_t topDownSteps = 0;
+        size_t bottomUpSteps = 0;
+    };
+
+    // Dense indices in and out; an out-of-range source yields an empty search
+    static Result run(const CSRGraph& graph, int source);
+};
@@ -0,0 +1,116 @@
+// File: src/CSRGraph.cpp
+#include "CSRGraph.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+    // Backing store for snapshots built in memory
+    struct OwnedArrays {
+        std::vector<CSRGraph::EdgeIndex> offsets;
+        std::vector<int> targets;
+        std::vector<int> weights;
+        std::vector<CSRGraph::EdgeIndex> reverseOffsets;
+        std::vector<int> sources;
+        std::vector<int> reverseWeights;
+        std::vector<NodeId> externalIds;
+        std::vector<NodeId> sortedIds;
+        std::vector<int> sortedIndex;
+    };
+
+    void buildRows(const std::vector<std::vector<std::pair<int, int>>>& rows,
+        std::vector<CSRGraph::EdgeIndex>& offsets, std::vector<int>& ends, std::vector<int>& weights) {
+        const size_t vertexCount = rows.size();
+        offsets.assign(vertexCount + 1, 0);
+
+        // Prefix-sum the degrees into row offsets
+        for (size_t v = 0; v < vertexCount; v++) {
+            offsets[v + 1] = offsets[v] + rows[v].size();
+        }
+
+        ends.resize(offsets[vertexCount]);
+        weights.resize(offsets[vertexCount]);
+
+        for (size_t v = 0; v < vertexCount; v++) {
+            CSRGraph::EdgeIndex pos = offsets[v];
+            for (const auto& [other, weight] : rows[v]) {
+                ends[pos] = other;
+                weights[pos] = weight;
+                pos++;
+            }
+        }
+    }
+}
+
+CSRGraph::CSRGraph() : lowestWeight(0), highestWeight(0) {
+    static const EdgeIndex emptyOffsets[1] = { 0 };
+    data.offsets = emptyOffsets;
+    data.reverseOffsets = emptyOffsets;
+}
+
+CSRGraph::CSRGraph(const std::vector<std::vector<std::pair<int, int>>>& adjacencyList,
+    const std::vector<std::vector<std::pair<int, int>>>& reverseAdjacencyList,
+    const std::vector<NodeId>& externalIds) {
+    auto owned = std::make_shared<OwnedArrays>();
+    buildRows(adjacencyList, owned->offsets, owned->targets, owned->weights);
+    buildRows(reverseAdjacencyList, owned->reverseOffsets, owned->sources, owned->reverseWeights);
+    owned->externalIds = externalIds;
+
+    // Only build a sorted lookup index when the IDs are not already ascending
+    if (!std::is_sorted(externalIds.begin(), externalIds.end())) {
+        owned->sortedIndex.resize(externalIds.size());
+        std::iota(owned->sortedIndex.begin(), owned->sortedIndex.end(), 0);
+        std::sort(owned->sortedIndex.begin(), owned->sortedIndex.end(),
+            [&](int a, int b) { return externalIds[a] < externalIds[b]; });
+        owned->sortedIds.reserve(externalIds.size());
+        for (int index : owned->sortedIndex) {
+            owned->sortedIds.push_back(externalIds[index]);
+        }
+    }
+
+    data.vertexCount = static_cast<int>(adjacencyList.size());
+    data.edgeCount = owned->targets.size();
+    data.offsets = owned->offsets.data();
+    data.targets = owned->targets.data();
+    data.weights = owned->weights.data();
+    data.reverseOffsets = owned->reverseOffsets.data();
+    data.sources = owned->sources.data();
+    data.reverseWeights = owned->reverseWeights.data();
+    data.externalIds = owned->externalIds.data();
+    if (!owned->sortedIds.empty()) {
+        data.sortedIds = owned->sortedIds.data();
+        data.sortedIndex = owned->sortedIndex.data();
+    }
+    storage = std::move(owned);
+    computeWeightRange();
+}
+
+CSRGraph::CSRGraph(const Arrays& arrays, std::shared_ptr<const void> storage)
+    : data(arrays), storage(std::move(storage)) {
+    computeWeightRange();
+}
+
+void CSRGraph::computeWeightRange() {
+    lowestWeight = 0;
+    highestWeight = 0;
+    if (data.edgeCount == 0) return;
+    auto [lowest, highest] = std::minmax_element(data.weights, data.weights + data.edgeCount);
+    lowestWeight = *lowest;
+    highestWeight = *highest;
+}
+
+int CSRGraph::toDense(NodeId id) const {
+    const NodeId* ids = data.sortedIds ? data.sortedIds : data.externalIds;
+    const NodeId* last = ids + data.vertexCount;
+    const NodeId* it = std::lower_bound(ids, last, id);
+    if (it == last || *it != id) return -1;
+    int position = static_cast<int>(it - ids);
+    return data.sortedIds ? data.sortedIndex[position] : position;
+}
+
+size_t CSRGraph::memoryFootprint() const {
+    const size_t vertices = static_cast<size_t>(data.vertexCount);
+    return 2 * (vertices + 1) * sizeof(EdgeIndex) +
+        4 * data.edgeCount * sizeof(int) +
+        vertices * sizeof(NodeId) +
+        (data.sortedIds ? vertices * (sizeof(NodeId) + sizeof(int)) : 0);
+}
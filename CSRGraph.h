@@ -0,0 +1,81 @@
+// File: include/CSRGraph.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "VertexIdMap.h"
+
+// Immutable compressed-sparse-row snapshot of a graph. The outgoing edges of
+// vertex v occupy positions [edgeBegin(v), edgeEnd(v)) of the target and
+// weight arrays, so a neighbor scan is a linear walk over contiguous memory.
+// The transposed graph is stored the same way for in-neighbor scans.
+//
+// The arrays are read through raw pointers so a snapshot can either own its
+// memory or view a memory-mapped file (see BinaryGraphFormat).
+class CSRGraph {
+public:
+    using EdgeIndex = std::uint64_t;
+
+    struct Arrays {
+        int vertexCount = 0;
+        EdgeIndex edgeCount = 0;
+        const EdgeIndex* offsets = nullptr;        // vertexCount + 1
+        const int* targets = nullptr;              // edgeCount
+        const int* weights = nullptr;              // edgeCount
+        const EdgeIndex* reverseOffsets = nullptr; // vertexCount + 1
+        const int* sources = nullptr;              // edgeCount
+        const int* reverseWeights = nullptr;       // edgeCount
+        const NodeId* externalIds = nullptr;       // vertexCount, dense order
+        // External IDs in ascending order with their dense indices; null when
+        // externalIds is itself ascending and can be searched directly
+        const NodeId* sortedIds = nullptr;
+        const int* sortedIndex = nullptr;
+    };
+
+private:
+    Arrays data;
+    std::shared_ptr<const void> storage;
+    // Smallest and largest edge weight, 0 for an edgeless graph
+    int lowestWeight;
+    int highestWeight;
+
+    void computeWeightRange();
+
+public:
+    CSRGraph();
+    // Builds from dense forward (target, weight) and reverse (source, weight)
+    // adjacency lists describing the same edge set
+    CSRGraph(const std::vector<std::vector<std::pair<int, int>>>& adjacencyList,
+        const std::vector<std::vector<std::pair<int, int>>>& reverseAdjacencyList,
+        const std::vector<NodeId>& externalIds);
+    // Adopts arrays living in externally managed memory kept alive by storage
+    CSRGraph(const Arrays& arrays, std::shared_ptr<const void> storage);
+
+    int numVertices() const { return data.vertexCount; }
+    EdgeIndex numEdges() const { return data.edgeCount; }
+
+    EdgeIndex edgeBegin(int vertex) const { return data.offsets[vertex]; }
+    EdgeIndex edgeEnd(int vertex) const { return data.offsets[vertex + 1]; }
+    int degree(int vertex) const { return static_cast<int>(data.offsets[vertex + 1] - data.offsets[vertex]); }
+    int target(EdgeIndex edge) const { return data.targets[edge]; }
+    int weight(EdgeIndex edge) const { return data.weights[edge]; }
+
+    EdgeIndex inEdgeBegin(int vertex) const { return data.reverseOffsets[vertex]; }
+    EdgeIndex inEdgeEnd(int vertex) const { return data.reverseOffsets[vertex + 1]; }
+    int inDegree(int vertex) const { return static_cast<int>(data.reverseOffsets[vertex + 1] - data.reverseOffsets[vertex]); }
+    int source(EdgeIndex edge) const { return data.sources[edge]; }
+    int inWeight(EdgeIndex edge) const { return data.reverseWeights[edge]; }
+    int minWeight() const { return lowestWeight; }
+    int maxWeight() const { return highestWeight; }
+
+    // ID translation between external node IDs and dense indices
+    NodeId toExternal(int vertex) const { return data.externalIds[vertex]; }
+    // Returns the dense index of id, or -1 if the snapshot does not contain it
+    int toDense(NodeId id) const;
+
+    const Arrays& arrays() const { return data; }
+    size_t memoryFootprint() const;
+};
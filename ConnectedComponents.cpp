@@ -0,0 +1,157 @@
+// File: src/ConnectedComponents.cpp
+#include "ConnectedComponents.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include "ParallelExecutor.h"
+
+namespace {
+    using LabelArray = std::unique_ptr<std::atomic<int>[]>;
+
+    // Hooks the tree of the higher root under the lower one until u and v
+    // share a root. Roots only ever decrease, so concurrent links converge.
+    void link(std::atomic<int>* parent, int u, int v) {
+        int p1 = parent[u].load(std::memory_order_relaxed);
+        int p2 = parent[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            const int high = std::max(p1, p2);
+            const int low = std::min(p1, p2);
+            int highParent = parent[high].load(std::memory_order_relaxed);
+            if (highParent == low) break;
+            if (highParent == high &&
+                parent[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed)) {
+                break;
+            }
+            p1 = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Points every vertex directly at its root
+    void compress(std::atomic<int>* parent, int vertexCount) {
+        ParallelExecutor::forEachChunk(vertexCount, 4096, [&](size_t first, size_t last, unsigned) {
+            for (size_t v = first; v < last; v++) {
+                int p = parent[v].load(std::memory_order_relaxed);
+                int grand = parent[p].load(std::memory_order_relaxed);
+                while (p != grand) {
+                    p = grand;
+                    grand = parent[p].load(std::memory_order_relaxed);
+                }
+                parent[v].store(p, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    int mostFrequentRoot(const std::atomic<int>* parent, int vertexCount) {
+        std::mt19937 rng(27491095);
+        std::unordered_map<int, int> counts;
+        for (int i = 0; i < ConnectedComponents::SAMPLES; i++) {
+            counts[parent[rng() % vertexCount].load(std::memory_order_relaxed)]++;
+        }
+        int best = -1;
+        int bestCount = 0;
+        for (const auto& [root, count] : counts) {
+            if (count > bestCount || (count == bestCount && root < best)) {
+                best = root;
+                bestCount = count;
+            }
+        }
+        return best;
+    }
+}
+
+ConnectedComponents::Result ConnectedComponents::run(const CSRGraph& graph) {
+    if (graph.numVertices() >= PARALLEL_THRESHOLD) {
+        return afforest(graph);
+    }
+    return sequential(graph);
+}
+
+ConnectedComponents::Result ConnectedComponents::sequential(const CSRGraph& graph) {
+    const int vertexCount = graph.numVertices();
+    Result result;
+    result.component.assign(vertexCount, -1);
+    std::vector<std::uint64_t> visited((static_cast<size_t>(vertexCount) + 63) / 64, 0);
+    auto visit = [&](int v) {
+        std::uint64_t bit = std::uint64_t(1) << (v & 63);
+        if (visited[v >> 6] & bit) return false;
+        visited[v >> 6] |= bit;
+        return true;
+    };
+
+    std::vector<int> stack;
+    for (int root = 0; root < vertexCount; root++) {
+        if (!visit(root)) continue;
+        const int id = result.count++;
+        stack.assign(1, root);
+        while (!stack.empty()) {
+            const int v = stack.back();
+            stack.pop_back();
+            result.component[v] = id;
+            for (auto e = graph.edgeBegin(v), last = graph.edgeEnd(v); e < last; ++e) {
+                if (visit(graph.target(e))) stack.push_back(graph.target(e));
+            }
+            for (auto e = graph.inEdgeBegin(v), last = graph.inEdgeEnd(v); e < last; ++e) {
+                if (visit(graph.source(e))) stack.push_back(graph.source(e));
+            }
+        }
+    }
+    return result;
+}
+
+ConnectedComponents::Result ConnectedComponents::afforest(const CSRGraph& graph) {
+    const int vertexCount = graph.numVertices();
+    Result result;
+    if (vertexCount == 0) return result;
+
+    LabelArray parent(new std::atomic<int>[vertexCount]);
+    ParallelExecutor::forEachChunk(vertexCount, 4096, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            parent[v].store(static_cast<int>(v), std::memory_order_relaxed);
+        }
+    });
+
+    // Sampling phase: the first few out-edges of every vertex
+    for (int round = 0; round < NEIGHBOR_ROUNDS; round++) {
+        ParallelExecutor::forEachChunk(vertexCount, 1024, [&](size_t first, size_t last, unsigned) {
+            for (size_t v = first; v < last; v++) {
+                const int u = static_cast<int>(v);
+                if (round < graph.degree(u)) link(parent.get(), u, graph.target(graph.edgeBegin(u) + round));
+            }
+        });
+        compress(parent.get(), vertexCount);
+    }
+
+    // Finish everything outside the largest sampled component. Its members
+    // need not link their remaining out-edges: any edge leaving it is seen
+    // from the other end's in-edges.
+    const int giant = mostFrequentRoot(parent.get(), vertexCount);
+    ParallelExecutor::forEachChunk(vertexCount, 1024, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            const int u = static_cast<int>(v);
+            if (parent[u].load(std::memory_order_relaxed) == giant) continue;
+            for (auto e = graph.edgeBegin(u) + NEIGHBOR_ROUNDS, end = graph.edgeEnd(u); e < end; ++e) {
+                link(parent.get(), u, graph.target(e));
+            }
+            for (auto e = graph.inEdgeBegin(u), end = graph.inEdgeEnd(u); e < end; ++e) {
+                link(parent.get(), u, graph.source(e));
+            }
+        }
+    });
+    compress(parent.get(), vertexCount);
+
+    // Roots are each component's lowest vertex; number them in vertex order
+    result.component.resize(vertexCount);
+    for (int v = 0; v < vertexCount; v++) {
+        if (parent[v].load(std::memory_order_relaxed) == v) result.component[v] = result.count++;
+    }
+    ParallelExecutor::forEachChunk(vertexCount, 4096, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            const int root = parent[v].load(std::memory_order_relaxed);
+            if (root != static_cast<int>(v)) result.component[v] = result.component[root];
+        }
+    });
+    return result;
+}
@@ -0,0 +1,37 @@
+// File: include/ConnectedComponents.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+
+// Weakly connected components of a CSRGraph snapshot, i.e. components of
+// the graph with edge directions ignored.
+class ConnectedComponents {
+public:
+    // Below this many vertices the sequential traversal is faster; above it
+    // afforest wins even on one thread, as it skips most of the edges
+    static constexpr int PARALLEL_THRESHOLD = 1 << 16;
+    // Afforest: out-edges per vertex linked before sampling the giant component
+    static constexpr int NEIGHBOR_ROUNDS = 2;
+    static constexpr int SAMPLES = 1024;
+
+    struct Result {
+        // Component of each dense vertex, numbered 0..count-1 in order of
+        // each component's lowest vertex
+        std::vector<int> component;
+        int count = 0;
+    };
+
+    // Sequential below PARALLEL_THRESHOLD vertices, afforest above
+    static Result run(const CSRGraph& graph);
+
+    // Iterative traversal over out- and in-edges with a visited bitmap
+    static Result sequential(const CSRGraph& graph);
+
+    // Afforest (Sutton et al.): parallel label hooking with compression.
+    // A few sampled edges per vertex first merge most of the graph; the
+    // largest component found is then skipped while the remaining vertices
+    // link the rest of their edges.
+    static Result afforest(const CSRGraph& graph);
+};
@@ -0,0 +1,506 @@
+// File: src/ContractionHierarchy.cpp
+#include "ContractionHierarchy.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+    const int INF = DijkstraWorkspace::INF;
+    const char MAGIC[8] = { 'G', 'A', 'T', 'C', 'H', '\0', '\0', '\0' };
+    const std::uint32_t ENDIANNESS_MARKER = 0x01020304;
+
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t endianness;
+        std::int64_t vertexCount;
+        std::uint64_t baseEdgeCount;
+        std::uint64_t upCount;
+        std::uint64_t downCount;
+    };
+
+    struct Arc {
+        int other;
+        int weight;
+        int middle;
+    };
+
+    // Mutable graph being contracted. Arc lists are kept free of duplicates
+    // and of already contracted vertices.
+    class ContractionGraph {
+    public:
+        std::vector<std::vector<Arc>> out;
+        std::vector<std::vector<Arc>> in;
+        std::vector<int> contractedNeighbors;
+        // One more than the deepest contracted neighbour; keeps the hierarchy shallow
+        std::vector<int> depth;
+
+        explicit ContractionGraph(const CSRGraph& graph)
+            : out(graph.numVertices()), in(graph.numVertices()),
+            contractedNeighbors(graph.numVertices(), 0), depth(graph.numVertices(), 0) {
+            for (int u = 0; u < graph.numVertices(); u++) {
+                for (auto e = graph.edgeBegin(u), last = graph.edgeEnd(u); e < last; ++e) {
+                    if (graph.target(e) != u) addArc(u, graph.target(e), graph.weight(e), -1);
+                }
+            }
+        }
+
+        // Adds u -> x, or lowers the weight of an existing u -> x arc
+        void addArc(int u, int x, int weight, int middle) {
+            auto update = [&](std::vector<Arc>& arcs, int other) {
+                for (Arc& arc : arcs) {
+                    if (arc.other == other) {
+                        if (weight < arc.weight) arc = { other, weight, middle };
+                        return;
+                    }
+                }
+                arcs.push_back({ other, weight, middle });
+            };
+            update(out[u], x);
+            update(in[x], u);
+        }
+
+        // Settle-limited Dijkstra from source that avoids the vertex being
+        // contracted; stops once distances exceed limit
+        void witnessSearch(int source, int excluded, int limit, DijkstraWorkspace& workspace) const {
+            workspace.beginQuery(static_cast<int>(out.size()));
+            workspace.setLabel(source, 0, -1);
+            workspace.push(0, source);
+            int settled = 0;
+            while (!workspace.empty()) {
+                auto [dist, current] = workspace.pop();
+                if (dist > workspace.getDistance(current)) continue;
+                if (dist > limit || ++settled > ContractionHierarchy::WITNESS_SETTLE_LIMIT) break;
+                for (const Arc& arc : out[current]) {
+                    if (arc.other == excluded) continue;
+                    int candidate = dist + arc.weight;
+                    if (candidate < workspace.getDistance(arc.other)) {
+                        workspace.setLabel(arc.other, candidate, current);
+                        workspace.push(candidate, arc.other);
+                    }
+                }
+            }
+        }
+
+        // Number of shortcuts contracting v needs; adds them when apply is set
+        int contract(int v, bool apply, DijkstraWorkspace& workspace) {
+            int shortcuts = 0;
+            // Shortcuts only touch the lists of v's neighbours, never v's own
+            for (const Arc& inArc : in[v]) {
+                int maxOut = -1;
+                for (const Arc& outArc : out[v]) {
+                    if (outArc.other != inArc.other) maxOut = std::max(maxOut, outArc.weight);
+                }
+                if (maxOut < 0) continue;
+
+                witnessSearch(inArc.other, v, inArc.weight + maxOut, workspace);
+                for (const Arc& outArc : out[v]) {
+                    if (outArc.other == inArc.other) continue;
+                    int viaV = inArc.weight + outArc.weight;
+                    if (workspace.getDistance(outArc.other) > viaV) {
+                        shortcuts++;
+                        if (apply) addArc(inArc.other, outArc.other, viaV, v);
+                    }
+                }
+            }
+            return shortcuts;
+        }
+
+        int priority(int v, DijkstraWorkspace& workspace) {
+            int removed = static_cast<int>(in[v].size() + out[v].size());
+            return 2 * (contract(v, false, workspace) - removed) + contractedNeighbors[v] + depth[v];
+        }
+
+        // Detaches v from the remaining graph once its edges are recorded
+        void remove(int v) {
+            auto erase = [v](std::vector<Arc>& arcs) {
+                arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+                    [v](const Arc& arc) { return arc.other == v; }), arcs.end());
+            };
+            for (const Arc& arc : out[v]) {
+                erase(in[arc.other]);
+                contractedNeighbors[arc.other]++;
+                depth[arc.other] = std::max(depth[arc.other], depth[v] + 1);
+            }
+            for (const Arc& arc : in[v]) {
+                erase(out[arc.other]);
+                contractedNeighbors[arc.other]++;
+                depth[arc.other] = std::max(depth[arc.other], depth[v] + 1);
+            }
+            std::vector<Arc>().swap(out[v]);
+            std::vector<Arc>().swap(in[v]);
+        }
+    };
+
+    void flatten(const std::vector<std::vector<Arc>>& rows, std::vector<CSRGraph::EdgeIndex>& offsets,
+        std::vector<int>& heads, std::vector<int>& weights, std::vector<int>& middles) {
+        offsets.assign(rows.size() + 1, 0);
+        for (size_t v = 0; v < rows.size(); v++) {
+            offsets[v + 1] = offsets[v] + rows[v].size();
+        }
+        heads.reserve(offsets.back());
+        weights.reserve(offsets.back());
+        middles.reserve(offsets.back());
+        for (const auto& row : rows) {
+            for (const Arc& arc : row) {
+                heads.push_back(arc.other);
+                weights.push_back(arc.weight);
+                middles.push_back(arc.middle);
+            }
+        }
+    }
+
+    template <typename T>
+    void writeArray(std::ofstream& out, const std::vector<T>& values) {
+        out.write(reinterpret_cast<const char*>(values.data()),
+            static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template <typename T>
+    void readArray(std::ifstream& in, std::vector<T>& values, std::uint64_t count) {
+        values.resize(static_cast<size_t>(count));
+        in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+}
+
+ContractionHierarchy::ContractionHierarchy() : vertexCount(0), baseEdgeCount(0) {}
+
+ContractionHierarchy::ContractionHierarchy(const CSRGraph& graph)
+    : vertexCount(graph.numVertices()), baseEdgeCount(graph.numEdges()), rank(graph.numVertices(), 0) {
+    ContractionGraph working(graph);
+    DijkstraWorkspace workspace;
+    std::vector<std::vector<Arc>> up(vertexCount);
+    std::vector<std::vector<Arc>> down(vertexCount);
+
+    using Entry = std::pair<int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> order;
+    for (int v = 0; v < vertexCount; v++) {
+        order.push({ working.priority(v, workspace), v });
+    }
+
+    int nextRank = 0;
+    while (!order.empty()) {
+        int v = order.top().second;
+        order.pop();
+
+        // Lazy update: re-evaluate and defer if no longer the cheapest
+        int current = working.priority(v, workspace);
+        if (!order.empty() && current > order.top().first) {
+            order.push({ current, v });
+            continue;
+        }
+
+        working.contract(v, true, workspace);
+        up[v] = working.out[v];
+        down[v] = working.in[v];
+        working.remove(v);
+        rank[v] = nextRank++;
+    }
+
+    flatten(up, upOffsets, upHead, upWeight, upMiddle);
+    flatten(down, downOffsets, downTail, downWeight, downMiddle);
+}
+
+size_t ContractionHierarchy::numShortcuts() const {
+    size_t shortcuts = 0;
+    for (int middle : upMiddle) shortcuts += middle >= 0;
+    for (int middle : downMiddle) shortcuts += middle >= 0;
+    return shortcuts;
+}
+
+size_t ContractionHierarchy::memoryFootprint() const {
+    return (upOffsets.size() + downOffsets.size()) * sizeof(CSRGraph::EdgeIndex) +
+        (rank.size() + 3 * upHead.size() + 3 * downTail.size()) * sizeof(int);
+}
+
+CSRGraph::EdgeIndex ContractionHierarchy::findUp(int from, int to) const {
+    for (auto e = upOffsets[from]; e < upOffsets[from + 1]; ++e) {
+        if (upHead[e] == to) return e;
+    }
+    throw std::logic_error("Contraction hierarchy is missing an upward edge");
+}
+
+CSRGraph::EdgeIndex ContractionHierarchy::findDown(int from, int to) const {
+    for (auto e = downOffsets[to]; e < downOffsets[to + 1]; ++e) {
+        if (downTail[e] == from) return e;
+    }
+    throw std::logic_error("Contraction hierarchy is missing a downward edge");
+}
+
+bool ContractionHierarchy::isConsistent() const {
+    std::vector<char> seen(vertexCount, 0);
+    for (int r : rank) {
+        if (r < 0 || r >= vertexCount || seen[r]) return false;
+        seen[r] = 1;
+    }
+
+    auto offsetsValid = [&](const std::vector<CSRGraph::EdgeIndex>& offsets, size_t count) {
+        if (offsets.front() != 0 || offsets.back() != count) return false;
+        for (int v = 0; v < vertexCount; v++) {
+            if (offsets[v] > offsets[v + 1]) return false;
+        }
+        return true;
+    };
+    if (!offsetsValid(upOffsets, upHead.size()) || !offsetsValid(downOffsets, downTail.size())) {
+        return false;
+    }
+
+    auto above = [&](int other, int v) {
+        return other >= 0 && other < vertexCount && rank[other] > rank[v];
+    };
+    auto hasUp = [&](int from, int to) {
+        for (auto e = upOffsets[from]; e < upOffsets[from + 1]; ++e) {
+            if (upHead[e] == to) return true;
+        }
+        return false;
+    };
+    auto hasDown = [&](int from, int to) {
+        for (auto e = downOffsets[to]; e < downOffsets[to + 1]; ++e) {
+            if (downTail[e] == from) return true;
+        }
+        return false;
+    };
+    // Shortcut from -> to via middle unpacks to from -> middle (downward)
+    // and middle -> to (upward); the rank test also bounds unpacking depth
+    auto validMiddle = [&](int from, int to, int middle) {
+        if (middle < 0) return middle == -1;
+        return middle < vertexCount && above(from, middle) && above(to, middle) &&
+            hasDown(from, middle) && hasUp(middle, to);
+    };
+
+    for (int v = 0; v < vertexCount; v++) {
+        for (auto e = upOffsets[v]; e < upOffsets[v + 1]; ++e) {
+            if (!above(upHead[e], v) || !validMiddle(v, upHead[e], upMiddle[e])) return false;
+        }
+        for (auto e = downOffsets[v]; e < downOffsets[v + 1]; ++e) {
+            if (!above(downTail[e], v) || !validMiddle(downTail[e], v, downMiddle[e])) return false;
+        }
+    }
+    return true;
+}
+
+void ContractionHierarchy::unpackEdge(int from, int to, int middle, std::vector<int>& path) const {
+    // Appends the vertices after from on the original path from -> to
+    std::vector<std::pair<int, int>> pending;
+    pending.push_back({ from, to });
+    std::vector<int> middles = { middle };
+    while (!pending.empty()) {
+        auto [u, x] = pending.back();
+        int via = middles.back();
+        pending.pop_back();
+        middles.pop_back();
+        if (via < 0) {
+            path.push_back(x);
+            continue;
+        }
+        // via ranks below both ends: u -> via is downward, via -> x upward
+        pending.push_back({ via, x });
+        middles.push_back(upMiddle[findUp(via, x)]);
+        pending.push_back({ u, via });
+        middles.push_back(downMiddle[findDown(u, via)]);
+    }
+}
+
+int ContractionHierarchy::query(int source, int target, DijkstraWorkspace& forward,
+    DijkstraWorkspace& backward, std::vector<int>* path) const {
+    forward.beginQuery(vertexCount);
+    backward.beginQuery(vertexCount);
+    forward.setLabel(source, 0, -1);
+    forward.push(0, source);
+    backward.setLabel(target, 0, -1);
+    backward.push(0, target);
+
+    long long best = INF;
+    int meeting = -1;
+
+    // Each direction continues until its queue head cannot improve on best
+    while (true) {
+        bool forwardActive = !forward.empty() && forward.top().first < best;
+        bool backwardActive = !backward.empty() && backward.top().first < best;
+        if (!forwardActive && !backwardActive) break;
+
+        bool forwardStep = forwardActive &&
+            (!backwardActive || forward.top().first <= backward.top().first);
+        DijkstraWorkspace& side = forwardStep ? forward : backward;
+        const DijkstraWorkspace& other = forwardStep ? backward : forward;
+
+        auto [dist, current] = side.pop();
+        if (dist > side.getDistance(current)) continue;
+        side.markSettled();
+
+        if (other.isReached(current)) {
+            long long total = static_cast<long long>(dist) + other.getDistance(current);
+            if (total < best) {
+                best = total;
+                meeting = current;
+            }
+        }
+
+        // Forward search climbs upward edges; edges arriving from higher
+        // ranked vertices show whether current was reached suboptimally
+        const auto& offsets = forwardStep ? upOffsets : downOffsets;
+        const auto& heads = forwardStep ? upHead : downTail;
+        const auto& weights = forwardStep ? upWeight : downWeight;
+        const auto& stallOffsets = forwardStep ? downOffsets : upOffsets;
+        const auto& stallHeads = forwardStep ? downTail : upHead;
+        const auto& stallWeights = forwardStep ? downWeight : upWeight;
+
+        bool stalled = false;
+        for (auto e = stallOffsets[current]; e < stallOffsets[current + 1] && !stalled; ++e) {
+            int reached = side.getDistance(stallHeads[e]);
+            stalled = reached != INF && reached + stallWeights[e] < dist;
+        }
+        if (stalled) continue;
+
+        for (auto e = offsets[current]; e < offsets[current + 1]; ++e) {
+            int next = heads[e];
+            int candidate = dist + weights[e];
+            if (candidate < side.getDistance(next)) {
+                side.setLabel(next, candidate, current);
+                side.push(candidate, next);
+            }
+        }
+    }
+
+    if (path) {
+        path->clear();
+        if (meeting >= 0) {
+            std::vector<int> upward;
+            for (int at = meeting; at != -1; at = forward.getParent(at)) {
+                upward.push_back(at);
+            }
+            std::reverse(upward.begin(), upward.end());
+
+            path->push_back(source);
+            for (size_t i = 0; i + 1 < upward.size(); i++) {
+                unpackEdge(upward[i], upward[i + 1], upMiddle[findUp(upward[i], upward[i + 1])], *path);
+            }
+            for (int at = meeting, next = backward.getParent(at); next != -1;
+                at = next, next = backward.getParent(at)) {
+                unpackEdge(at, next, downMiddle[findDown(at, next)], *path);
+            }
+        }
+    }
+
+    return meeting >= 0 ? static_cast<int>(best) : INF;
+}
+
+void ContractionHierarchy::save(const std::string& filename) const {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot create hierarchy file: " + filename);
+    }
+
+    FileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.endianness = ENDIANNESS_MARKER;
+    header.vertexCount = vertexCount;
+    header.baseEdgeCount = baseEdgeCount;
+    header.upCount = upHead.size();
+    header.downCount = downTail.size();
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(out, rank);
+    writeArray(out, upOffsets);
+    writeArray(out, upHead);
+    writeArray(out, upWeight);
+    writeArray(out, upMiddle);
+    writeArray(out, downOffsets);
+    writeArray(out, downTail);
+    writeArray(out, downWeight);
+    writeArray(out, downMiddle);
+
+    if (!out) {
+        throw std::runtime_error("Failed writing hierarchy file: " + filename);
+    }
+}
+
+std::shared_ptr<const ContractionHierarchy> ContractionHierarchy::load(const std::string& filename,
+    const CSRGraph& graph) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open hierarchy file: " + filename);
+    }
+    const std::uint64_t fileSize = static_cast<std::uint64_t>(in.tellg());
+    in.seekg(0);
+
+    FileHeader header;
+    if (fileSize < sizeof(header) || !in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Truncated hierarchy file: " + filename);
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a hierarchy file: " + filename);
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported hierarchy file version " +
+            std::to_string(header.version) + ": " + filename);
+    }
+    if (header.endianness != ENDIANNESS_MARKER) {
+        throw std::runtime_error("Hierarchy file has foreign byte order: " + filename);
+    }
+    if (header.vertexCount != graph.numVertices() || header.baseEdgeCount != graph.numEdges()) {
+        throw std::runtime_error("Hierarchy file was built for a different graph: " + filename);
+    }
+
+    // The vertex count matches the graph, so only the arc counts can be
+    // corrupt; they are bounded by the file size before any multiplication
+    const std::uint64_t vertices = static_cast<std::uint64_t>(header.vertexCount);
+    const std::uint64_t vertexBytes = sizeof(header) + vertices * sizeof(int) +
+        2 * (vertices + 1) * sizeof(CSRGraph::EdgeIndex);
+    const std::uint64_t arcSize = 3 * sizeof(int);
+    if (fileSize < vertexBytes || header.upCount > (fileSize - vertexBytes) / arcSize ||
+        header.downCount > (fileSize - vertexBytes) / arcSize ||
+        (header.upCount + header.downCount) * arcSize != fileSize - vertexBytes) {
+        throw std::runtime_error("Corrupt hierarchy file: " + filename);
+    }
+
+    auto hierarchy = std::shared_ptr<ContractionHierarchy>(new ContractionHierarchy());
+    hierarchy->vertexCount = static_cast<int>(header.vertexCount);
+    hierarchy->baseEdgeCount = header.baseEdgeCount;
+    readArray(in, hierarchy->rank, vertices);
+    readArray(in, hierarchy->upOffsets, vertices + 1);
+    readArray(in, hierarchy->upHead, header.upCount);
+    readArray(in, hierarchy->upWeight, header.upCount);
+    readArray(in, hierarchy->upMiddle, header.upCount);
+    readArray(in, hierarchy->downOffsets, vertices + 1);
+    readArray(in, hierarchy->downTail, header.downCount);
+    readArray(in, hierarchy->downWeight, header.downCount);
+    readArray(in, hierarchy->downMiddle, header.downCount);
+
+    if (!in || !hierarchy->isConsistent()) {
+        throw std::runtime_error("Corrupt hierarchy file: " + filename);
+    }
+    return hierarchy;
+}
+
+HierarchyQuery::HierarchyQuery(std::shared_ptr<const CSRGraph> graph,
+    std::shared_ptr<const ContractionHierarchy> hierarchy)
+    : graph(std::move(graph)), hierarchy(std::move(hierarchy)) {}
+
+std::pair<std::vector<NodeId>, int> HierarchyQuery::shortestPath(NodeId start, NodeId end) {
+    int source = graph->toDense(start);
+    int target = graph->toDense(end);
+    if (source < 0 || target < 0) {
+        return { {}, DijkstraWorkspace::INF };
+    }
+
+    int distance;
+    if (graph->minWeight() < 0) {
+        // Shortcuts are only exact for non-negative weights
+        distance = forward.run(*graph, source, target);
+        densePath = forward.extractPath(target);
+    }
+    else {
+        distance = hierarchy->query(source, target, forward, backward, &densePath);
+    }
+    std::vector<NodeId> path;
+    path.reserve(densePath.size());
+    for (int vertex : densePath) {
+        path.push_back(graph->toExternal(vertex));
+    }
+    return { path, distance };
+}
@@ -0,0 +1,96 @@
+// File: include/ContractionHierarchy.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "CSRGraph.h"
+#include "DijkstraWorkspace.h"
+
+// Contraction hierarchy over a CSRGraph snapshot. Vertices are contracted one
+// at a time in order of importance (edge difference plus contracted
+// neighbours, updated lazily); contracting v adds a shortcut u -> x whenever
+// u -> v -> x is the only shortest path between them, as decided by a
+// settle-limited witness search. Every edge then leads either up or down the
+// ranking:
+//   upward:   v -> x with rank[x] > rank[v], scanned by the forward search
+//   downward: u -> v with rank[u] > rank[v], stored at v and scanned by the
+//             backward search from the target over in-edges
+// A query is a bidirectional Dijkstra that only climbs, with stall-on-demand
+// pruning, so it settles a few hundred vertices even on very large graphs.
+// Shortcuts record their middle vertex and are unpacked into full paths.
+class ContractionHierarchy {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+    // Witness searches give up after settling this many vertices; a failed
+    // search only costs an unnecessary shortcut, never a wrong distance
+    static constexpr int WITNESS_SETTLE_LIMIT = 200;
+
+private:
+    int vertexCount;
+    CSRGraph::EdgeIndex baseEdgeCount;
+    std::vector<int> rank;
+    // Per-vertex upward edges (head, weight, middle vertex or -1)
+    std::vector<CSRGraph::EdgeIndex> upOffsets;
+    std::vector<int> upHead;
+    std::vector<int> upWeight;
+    std::vector<int> upMiddle;
+    // Per-vertex downward edges (tail, weight, middle vertex or -1)
+    std::vector<CSRGraph::EdgeIndex> downOffsets;
+    std::vector<int> downTail;
+    std::vector<int> downWeight;
+    std::vector<int> downMiddle;
+
+    ContractionHierarchy();
+
+    CSRGraph::EdgeIndex findUp(int from, int to) const;
+    CSRGraph::EdgeIndex findDown(int from, int to) const;
+    void unpackEdge(int from, int to, int middle, std::vector<int>& path) const;
+    // Structural checks for a loaded index: ranks form a permutation, offsets
+    // are monotone, every arc climbs in rank and every shortcut's middle
+    // ranks below both ends with both halves present
+    bool isConsistent() const;
+
+public:
+    explicit ContractionHierarchy(const CSRGraph& graph);
+
+    // Dense point-to-point distance, INF if unreachable. When path is given it
+    // receives the unpacked dense vertex path (empty if unreachable).
+    int query(int source, int target, DijkstraWorkspace& forward, DijkstraWorkspace& backward,
+        std::vector<int>* path) const;
+
+    int numVertices() const { return vertexCount; }
+    size_t numShortcuts() const;
+    int getRank(int vertex) const { return rank[vertex]; }
+    size_t memoryFootprint() const;
+
+    // Binary persistence so the index is built once per snapshot. load throws
+    // std::runtime_error if the file is malformed, fails the consistency
+    // checks or was built for a graph with different vertex or edge counts.
+    void save(const std::string& filename) const;
+    static std::shared_ptr<const ContractionHierarchy> load(const std::string& filename,
+        const CSRGraph& graph);
+};
+
+// Reusable query object bound to a snapshot and its hierarchy. Owns its search
+// workspaces, so each thread issuing queries should use its own instance.
+class HierarchyQuery {
+private:
+    std::shared_ptr<const CSRGraph> graph;
+    std::shared_ptr<const ContractionHierarchy> hierarchy;
+    DijkstraWorkspace forward;
+    DijkstraWorkspace backward;
+    std::vector<int> densePath;
+
+public:
+    HierarchyQuery(std::shared_ptr<const CSRGraph> graph,
+        std::shared_ptr<const ContractionHierarchy> hierarchy);
+
+    // Same contract as GraphAnalysisTool::shortestPath
+    std::pair<std::vector<NodeId>, int> shortestPath(NodeId start, NodeId end);
+    // Vertices settled by both directions in the last query
+    size_t settledVertices() const { return forward.settledVertices() + backward.settledVertices(); }
+};
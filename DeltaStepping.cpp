@@ -0,0 +1,133 @@
+// File: src/DeltaStepping.cpp
+#include "DeltaStepping.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include "ParallelExecutor.h"
+
+namespace {
+    const int INF = std::numeric_limits<int>::max();
+    const size_t GRAIN = 256;
+
+    // (vertex, distance it was queued with); entries whose distance has since
+    // been lowered are stale and skipped
+    using Entry = std::pair<int, int>;
+}
+
+int DeltaStepping::chooseDelta(const CSRGraph& graph) {
+    if (graph.numEdges() == 0) return 1;
+    const double averageDegree = static_cast<double>(graph.numEdges()) / graph.numVertices();
+    return std::max(1, static_cast<int>(graph.maxWeight() / std::max(1.0, averageDegree)));
+}
+
+DeltaStepping::Result DeltaStepping::run(const CSRGraph& graph, int source, int delta) {
+    const int vertexCount = graph.numVertices();
+    Result result;
+    if (graph.minWeight() < 0) return result;
+    const int maxWeight = std::max(graph.maxWeight(), 0);
+    result.delta = std::max(delta > 0 ? delta : chooseDelta(graph), maxWeight / MAX_BUCKETS + 1);
+    if (source < 0 || source >= vertexCount) {
+        result.distances.assign(vertexCount, INF);
+        return result;
+    }
+    const int width = result.delta;
+    // Queued distances lie in [current bucket start, that + maxWeight], so
+    // logical bucket b can live in slot b % slots without collisions
+    const size_t slots = static_cast<size_t>(maxWeight / width) + 1;
+
+    std::unique_ptr<std::atomic<int>[]> distance(new std::atomic<int>[vertexCount]);
+    ParallelExecutor::forEachChunk(vertexCount, 1 << 16, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            distance[v].store(INF, std::memory_order_relaxed);
+        }
+    });
+    distance[source].store(0, std::memory_order_relaxed);
+
+    // bins[thread][bucket % slots] holds the entries that thread queued for bucket
+    const unsigned threads = ParallelExecutor::threadCount();
+    std::vector<std::vector<std::vector<Entry>>> bins(threads, std::vector<std::vector<Entry>>(slots));
+    std::vector<std::vector<int>> settled(threads);
+    std::vector<size_t> relaxations(threads, 0);
+    bins[0][0].push_back({ source, 0 });
+
+    auto relax = [&](int vertex, int candidate, unsigned thread) {
+        relaxations[thread]++;
+        int old = distance[vertex].load(std::memory_order_relaxed);
+        while (candidate < old) {
+            if (distance[vertex].compare_exchange_weak(old, candidate, std::memory_order_relaxed)) {
+                bins[thread][static_cast<size_t>(candidate / width) % slots].push_back({ vertex, candidate });
+                return;
+            }
+        }
+    };
+
+    std::vector<Entry> frontier;
+    std::vector<int> bucketVertices;
+    size_t current = 0;
+    while (true) {
+        // Smallest non-empty bucket across all threads, at most one lap ahead
+        size_t next = std::numeric_limits<size_t>::max();
+        for (const auto& local : bins) {
+            for (size_t b = current; b < current + slots && b < next; b++) {
+                if (!local[b % slots].empty()) {
+                    next = b;
+                    break;
+                }
+            }
+        }
+        if (next == std::numeric_limits<size_t>::max()) break;
+        current = next;
+        const size_t slot = current % slots;
+        result.bucketsProcessed++;
+
+        // Light phase: settle the bucket, refilling it until it stays empty
+        while (true) {
+            frontier.clear();
+            for (auto& local : bins) {
+                frontier.insert(frontier.end(), local[slot].begin(), local[slot].end());
+                local[slot].clear();
+            }
+            if (frontier.empty()) break;
+
+            ParallelExecutor::forEachChunk(frontier.size(), GRAIN, [&](size_t first, size_t last, unsigned thread) {
+                for (size_t i = first; i < last; i++) {
+                    auto [vertex, queued] = frontier[i];
+                    if (distance[vertex].load(std::memory_order_relaxed) < queued) continue;
+                    settled[thread].push_back(vertex);
+                    for (auto e = graph.edgeBegin(vertex), end = graph.edgeEnd(vertex); e < end; ++e) {
+                        int weight = graph.weight(e);
+                        if (weight <= width) relax(graph.target(e), queued + weight, thread);
+                    }
+                }
+            });
+        }
+
+        // Heavy phase: relax the long edges of everything settled in this bucket
+        bucketVertices.clear();
+        for (auto& local : settled) {
+            bucketVertices.insert(bucketVertices.end(), local.begin(), local.end());
+            local.clear();
+        }
+        ParallelExecutor::forEachChunk(bucketVertices.size(), GRAIN, [&](size_t first, size_t last, unsigned thread) {
+            for (size_t i = first; i < last; i++) {
+                int vertex = bucketVertices[i];
+                int dist = distance[vertex].load(std::memory_order_relaxed);
+                for (auto e = graph.edgeBegin(vertex), end = graph.edgeEnd(vertex); e < end; ++e) {
+                    int weight = graph.weight(e);
+                    if (weight > width) relax(graph.target(e), dist + weight, thread);
+                }
+            }
+        });
+        current++;
+    }
+
+    result.distances.resize(vertexCount);
+    for (int v = 0; v < vertexCount; v++) {
+        result.distances[v] = distance[v].load(std::memory_order_relaxed);
+    }
+    for (size_t count : relaxations) {
+        result.relaxations += count;
+    }
+    return result;
+}
@@ -0,0 +1,39 @@
+// File: include/DeltaStepping.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+
+// Parallel delta-stepping single-source shortest paths (Meyer & Sanders).
+// Tentative distances are grouped into buckets of width delta and buckets are
+// settled in increasing order. Within a bucket, light edges (weight <= delta)
+// are relaxed repeatedly in parallel until the bucket stops refilling; heavy
+// edges can only reach later buckets and are relaxed once afterwards.
+// Distances are lowered with atomic compare-and-swap, and each worker thread
+// collects the vertices it improves in private bins, so no locks are taken.
+// Live distances never span more than max weight / delta + 1 buckets, so the
+// bins form a circular array of that many slots. Edge weights must be
+// non-negative.
+class DeltaStepping {
+public:
+    // Upper bound on circular bucket slots; delta is raised to stay within it
+    static constexpr int MAX_BUCKETS = 1 << 14;
+
+    struct Result {
+        // Dense order, INT_MAX if unreachable; empty if the graph has
+        // negative weights
+        std::vector<int> distances;
+        int delta = 0;                // Bucket width actually used
+        size_t bucketsProcessed = 0;
+        size_t relaxations = 0;
+    };
+
+    // delta <= 0 picks max weight / average out-degree
+    static Result run(const CSRGraph& graph, int source, int delta);
+    static Result run(const CSRGraph& graph, int source) {
+        return run(graph, source, 0);
+    }
+
+    static int chooseDelta(const CSRGraph& graph);
+};
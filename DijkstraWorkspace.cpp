@@ -0,0 +1,280 @@
+// File: src/DijkstraWorkspace.cpp
+#include "DijkstraWorkspace.h"
+#include <algorithm>
+#include <functional>
+
+DijkstraWorkspace::DijkstraWorkspace() : epoch(0), queueKind(QueueKind::BINARY_HEAP), settled(0) {}
+
+void DijkstraWorkspace::beginQuery(int vertexCount) {
+    if (static_cast<int>(stamp.size()) < vertexCount) {
+        distance.resize(vertexCount);
+        parent.resize(vertexCount);
+        stamp.resize(vertexCount, 0);
+    }
+    if (++epoch == 0) {
+        // Epoch counter wrapped; old stamps could alias the new epoch
+        std::fill(stamp.begin(), stamp.end(), 0);
+        epoch = 1;
+    }
+    heap.clear();
+    settled = 0;
+}
+
+void DijkstraWorkspace::push(int dist, int vertex) {
+    heap.push_back({ dist, vertex });
+    std::push_heap(heap.begin(), heap.end(), std::greater<>());
+}
+
+std::pair<int, int> DijkstraWorkspace::pop() {
+    std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+    auto entry = heap.back();
+    heap.pop_back();
+    return entry;
+}
+
+DijkstraWorkspace::QueueKind DijkstraWorkspace::selectQueue(const CSRGraph& graph) {
+    if (graph.minWeight() < 0) return QueueKind::BELLMAN_FORD;
+    if (graph.maxWeight() <= 1) return QueueKind::ZERO_ONE_DEQUE;
+    if (graph.maxWeight() <= MAX_BUCKET_WEIGHT) return QueueKind::DIAL_BUCKETS;
+    return QueueKind::BINARY_HEAP;
+}
+
+template <typename Stop>
+void DijkstraWorkspace::search(const CSRGraph& graph, int source, Direction direction, Stop&& stop) {
+    beginQuery(graph.numVertices());
+    setLabel(source, 0, -1);
+
+    queueKind = selectQueue(graph);
+    switch (queueKind) {
+    case QueueKind::ZERO_ONE_DEQUE:
+        runZeroOne(graph, source, direction, stop);
+        break;
+    case QueueKind::DIAL_BUCKETS:
+        runBuckets(graph, source, direction, stop);
+        break;
+    case QueueKind::BELLMAN_FORD:
+        runBellmanFord(graph, source, direction);
+        break;
+    default:
+        push(0, source);
+        runHeap(graph, direction, stop);
+        break;
+    }
+}
+
+int DijkstraWorkspace::run(const CSRGraph& graph, int source, int target, Direction direction) {
+    search(graph, source, direction, [target](int vertex) { return vertex == target; });
+    return target >= 0 ? getDistance(target) : INF;
+}
+
+void DijkstraWorkspace::runToTargets(const CSRGraph& graph, int source, const std::vector<char>& targetMask,
+    size_t targetCount, Direction direction) {
+    size_t remaining = targetCount;
+    search(graph, source, direction, [&](int vertex) {
+        return targetMask[vertex] && --remaining == 0;
+    });
+}
+
+template <typename Stop>
+void DijkstraWorkspace::runHeap(const CSRGraph& graph, Direction direction, Stop&& stop) {
+    while (!empty()) {
+        auto [dist, current] = pop();
+        if (dist > distance[current]) continue;
+        settled++;
+        if (stop(current)) break;
+
+        forEachNeighbor(graph, current, direction, [&](int next, int weight) {
+            int candidate = dist + weight;
+            if (candidate < getDistance(next)) {
+                setLabel(next, candidate, current);
+                push(candidate, next);
+            }
+        });
+    }
+}
+
+template <typename Stop>
+void DijkstraWorkspace::runBuckets(const CSRGraph& graph, int source, Direction direction, Stop&& stop) {
+    // Every queued distance lies in [d, d + max weight], so span buckets
+    // indexed modulo span never hold two different distances at once
+    const size_t span = static_cast<size_t>(graph.maxWeight()) + 1;
+    if (buckets.size() < span) buckets.resize(span);
+    for (size_t b = 0; b < span; b++) {
+        buckets[b].clear();
+    }
+
+    buckets[0].push_back(source);
+    size_t pending = 1;
+    for (int dist = 0; pending > 0; dist++) {
+        std::vector<int>& bucket = buckets[dist % span];
+        // Zero-weight edges append to the bucket being drained
+        for (size_t i = 0; i < bucket.size(); i++) {
+            int current = bucket[i];
+            pending--;
+            if (distance[current] != dist) continue;
+            settled++;
+            if (stop(current)) return;
+
+            forEachNeighbor(graph, current, direction, [&](int next, int weight) {
+                int candidate = dist + weight;
+                if (candidate < getDistance(next)) {
+                    setLabel(next, candidate, current);
+                    buckets[candidate % span].push_back(next);
+                    pending++;
+                }
+            });
+        }
+        bucket.clear();
+    }
+}
+
+template <typename Stop>
+void DijkstraWorkspace::runZeroOne(const CSRGraph& graph, int source, Direction direction, Stop&& stop) {
+    zeroOneQueue.clear();
+    zeroOneQueue.push_back({ 0, source });
+    while (!zeroOneQueue.empty()) {
+        auto [dist, current] = zeroOneQueue.front();
+        zeroOneQueue.pop_front();
+        if (dist > distance[current]) continue;
+        settled++;
+        if (stop(current)) break;
+
+        forEachNeighbor(graph, current, direction, [&](int next, int weight) {
+            int candidate = dist + weight;
+            if (candidate < getDistance(next)) {
+                setLabel(next, candidate, current);
+                if (weight == 0) {
+                    zeroOneQueue.push_front({ candidate, next });
+                }
+                else {
+                    zeroOneQueue.push_back({ candidate, next });
+                }
+            }
+        });
+    }
+}
+
+void DijkstraWorkspace::runBellmanFord(const CSRGraph& graph, int source, Direction direction) {
+    const int vertexCount = graph.numVertices();
+    if (static_cast<int>(queued.size()) < vertexCount) queued.resize(vertexCount, 0);
+    frontier.assign(1, source);
+    // Heads of edges that relax while a negative cycle is active
+    std::vector<int> unbounded;
+
+    // Round k relaxes the vertices improved in round k - 1, so after
+    // vertexCount - 1 rounds every shortest path is labeled unless a
+    // negative cycle keeps the frontier alive
+    auto relax = [&](int current, int next, int weight) {
+        long long candidate = static_cast<long long>(distance[current]) + weight;
+        if (candidate <= NEGATIVE_INF) {
+            // Distances outside the int range are treated as unbounded
+            unbounded.push_back(next);
+            return false;
+        }
+        if (candidate < getDistance(next)) {
+            setLabel(next, static_cast<int>(candidate), current);
+            return true;
+        }
+        return false;
+    };
+    for (int round = 1; round < vertexCount && !frontier.empty(); round++) {
+        nextFrontier.clear();
+        for (int current : frontier) {
+            settled++;
+            forEachNeighbor(graph, current, direction, [&](int next, int weight) {
+                if (relax(current, next, weight) && !queued[next]) {
+                    queued[next] = 1;
+                    nextFrontier.push_back(next);
+                }
+            });
+        }
+        for (int next : nextFrontier) {
+            queued[next] = 0;
+        }
+        frontier.swap(nextFrontier);
+    }
+    if (frontier.empty() && unbounded.empty()) return;
+
+    // Every reachable negative cycle still has an edge that relaxes; its
+    // head and everything reachable from it have no shortest path
+    if (!frontier.empty()) {
+        for (int v = 0; v < vertexCount; v++) {
+            if (!isReached(v)) continue;
+            forEachNeighbor(graph, v, direction, [&](int next, int weight) {
+                if (relax(v, next, weight)) unbounded.push_back(next);
+            });
+        }
+    }
+    while (!unbounded.empty()) {
+        int current = unbounded.back();
+        unbounded.pop_back();
+        if (getDistance(current) == NEGATIVE_INF) continue;
+        setLabel(current, NEGATIVE_INF, -1);
+        forEachNeighbor(graph, current, direction, [&](int next, int) {
+            if (getDistance(next) != NEGATIVE_INF) unbounded.push_back(next);
+        });
+    }
+}
+
+int DijkstraWorkspace::runBidirectional(const CSRGraph& graph, int source, int target,
+    DijkstraWorkspace& forward, DijkstraWorkspace& backward, int& meeting) {
+    forward.beginQuery(graph.numVertices());
+    backward.beginQuery(graph.numVertices());
+    forward.setLabel(source, 0, -1);
+    forward.push(0, source);
+    backward.setLabel(target, 0, -1);
+    backward.push(0, target);
+
+    long long best = source == target ? 0 : INF;
+    meeting = source == target ? source : -1;
+
+    while (!forward.empty() && !backward.empty()) {
+        if (static_cast<long long>(forward.top().first) + backward.top().first >= best) break;
+
+        bool forwardStep = forward.top().first <= backward.top().first;
+        DijkstraWorkspace& side = forwardStep ? forward : backward;
+        const DijkstraWorkspace& other = forwardStep ? backward : forward;
+
+        auto [dist, current] = side.pop();
+        if (dist > side.distance[current]) continue;
+        side.settled++;
+
+        forEachNeighbor(graph, current, forwardStep ? Direction::FORWARD : Direction::BACKWARD,
+            [&](int next, int weight) {
+                int candidate = dist + weight;
+                if (candidate < side.getDistance(next)) {
+                    side.setLabel(next, candidate, current);
+                    side.push(candidate, next);
+                }
+                if (other.isReached(next)) {
+                    long long total = static_cast<long long>(side.getDistance(next)) + other.distance[next];
+                    if (total < best) {
+                        best = total;
+                        meeting = next;
+                    }
+                }
+            });
+    }
+
+    return best < INF ? static_cast<int>(best) : INF;
+}
+
+std::vector<int> DijkstraWorkspace::joinPaths(const DijkstraWorkspace& forward,
+    const DijkstraWorkspace& backward, int meeting) {
+    if (meeting < 0) return {};
+    std::vector<int> path = forward.extractPath(meeting);
+    for (int at = backward.getParent(meeting); at != -1; at = backward.getParent(at)) {
+        path.push_back(at);
+    }
+    return path;
+}
+
+std::vector<int> DijkstraWorkspace::extractPath(int target) const {
+    std::vector<int> path;
+    if (!isReached(target) || distance[target] == NEGATIVE_INF) return path;
+    for (int at = target; at != -1; at = parent[at]) {
+        path.push_back(at);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
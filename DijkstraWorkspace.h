@@ -0,0 +1,179 @@
+// File: include/DijkstraWorkspace.h
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "CSRGraph.h"
+
+// Reusable state for shortest path queries on a CSRGraph. Distance and parent
+// labels are stamped with the query epoch, so starting a new query is O(1)
+// and a label is only valid if its stamp matches the current epoch. Per-query
+// cost therefore scales with the explored region rather than the graph size.
+class DijkstraWorkspace {
+public:
+    static constexpr int INF = std::numeric_limits<int>::max();
+    // Distance of vertices that a negative cycle can bring arbitrarily close
+    static constexpr int NEGATIVE_INF = std::numeric_limits<int>::min();
+
+    // FORWARD follows out-edges; BACKWARD follows in-edges, so the labels
+    // become distances *to* the source in the original graph
+    enum class Direction { FORWARD, BACKWARD };
+
+    // Priority queue used by run(), picked from the graph's weight range.
+    // Monotone integer queues avoid the heap's log factor and duplicate
+    // entries when weights are small non-negative integers.
+    enum class QueueKind {
+        BINARY_HEAP,    // Non-negative weights
+        DIAL_BUCKETS,   // Weights in [0, MAX_BUCKET_WEIGHT], circular buckets
+        ZERO_ONE_DEQUE, // Weights 0 and 1 only (0-1 BFS)
+        BELLMAN_FORD    // Negative weights; rounds over the improved frontier
+    };
+    static constexpr int MAX_BUCKET_WEIGHT = 1024;
+
+private:
+    std::vector<int> distance;
+    std::vector<int> parent;
+    std::vector<std::uint32_t> stamp;
+    std::uint32_t epoch;
+    // Min-heap of (distance, vertex) entries with lazy deletion
+    std::vector<std::pair<int, int>> heap;
+    // Dial buckets indexed by distance modulo (max weight + 1)
+    std::vector<std::vector<int>> buckets;
+    // 0-1 BFS deque of (distance, vertex) entries
+    std::deque<std::pair<int, int>> zeroOneQueue;
+    // Bellman-Ford frontiers: vertices improved in the previous round and in
+    // the current one, with queued marking membership of the current one
+    std::vector<int> frontier;
+    std::vector<int> nextFrontier;
+    std::vector<char> queued;
+    QueueKind queueKind;
+    size_t settled;
+
+    template <typename Visit>
+    static void forEachNeighbor(const CSRGraph& graph, int vertex, Direction direction, Visit&& visit) {
+        if (direction == Direction::FORWARD) {
+            for (auto e = graph.edgeBegin(vertex), last = graph.edgeEnd(vertex); e < last; ++e) {
+                visit(graph.target(e), graph.weight(e));
+            }
+        }
+        else {
+            for (auto e = graph.inEdgeBegin(vertex), last = graph.inEdgeEnd(vertex); e < last; ++e) {
+                visit(graph.source(e), graph.inWeight(e));
+            }
+        }
+    }
+
+    // Search drivers for each queue kind; stop(vertex) is called as each
+    // vertex is settled and ends the search by returning true
+    template <typename Stop>
+    void search(const CSRGraph& graph, int source, Direction direction, Stop&& stop);
+    template <typename Stop>
+    void runHeap(const CSRGraph& graph, Direction direction, Stop&& stop);
+    template <typename Stop>
+    void runBuckets(const CSRGraph& graph, int source, Direction direction, Stop&& stop);
+    template <typename Stop>
+    void runZeroOne(const CSRGraph& graph, int source, Direction direction, Stop&& stop);
+    // Settles everything reachable, since a later negative edge can still
+    // lower a vertex; there is no early stop
+    void runBellmanFord(const CSRGraph& graph, int source, Direction direction);
+
+public:
+    DijkstraWorkspace();
+
+    // Starts a new query over vertexCount vertices, invalidating all labels
+    void beginQuery(int vertexCount);
+
+    int getDistance(int vertex) const { return stamp[vertex] == epoch ? distance[vertex] : INF; }
+    int getParent(int vertex) const { return stamp[vertex] == epoch ? parent[vertex] : -1; }
+    bool isReached(int vertex) const { return stamp[vertex] == epoch; }
+    void setLabel(int vertex, int dist, int parentVertex) {
+        stamp[vertex] = epoch;
+        distance[vertex] = dist;
+        parent[vertex] = parentVertex;
+    }
+
+    // Queue primitives used by the search drivers
+    void push(int dist, int vertex);
+    bool empty() const { return heap.empty(); }
+    std::pair<int, int> top() const { return heap.front(); }
+    std::pair<int, int> pop();
+    // Counts a settled vertex for search drivers outside this class
+    void markSettled() { settled++; }
+
+    // Runs Dijkstra from source, stopping once target is settled (pass -1 to
+    // settle everything reachable). Returns the distance to target, or INF.
+    // The queue is chosen by selectQueue. With negative weights the search
+    // is Bellman-Ford instead and always covers everything reachable;
+    // vertices a reachable negative cycle leads to get NEGATIVE_INF and no
+    // path.
+    int run(const CSRGraph& graph, int source, int target, Direction direction = Direction::FORWARD);
+
+    // Many-target variant: stops once all targetCount vertices flagged in
+    // targetMask (indexed by dense vertex) are settled
+    void runToTargets(const CSRGraph& graph, int source, const std::vector<char>& targetMask,
+        size_t targetCount, Direction direction = Direction::FORWARD);
+
+    static QueueKind selectQueue(const CSRGraph& graph);
+    // Queue used by the last run()
+    QueueKind lastQueue() const { return queueKind; }
+
+    // Bidirectional Dijkstra: forward searches out-edges from source while
+    // backward searches in-edges from target, alternating on the smaller
+    // queue head and stopping once the two frontiers cannot improve the best
+    // meeting point. Returns the distance (INF if none) and sets meeting.
+    static int runBidirectional(const CSRGraph& graph, int source, int target,
+        DijkstraWorkspace& forward, DijkstraWorkspace& backward, int& meeting);
+
+    // A* from source to target guided by potential(v), a consistent lower
+    // bound on the distance from v to target; INF marks v as unable to reach
+    // target and prunes it. Returns the distance to target, or INF.
+    template <typename Potential>
+    int runAStar(const CSRGraph& graph, int source, int target, Potential&& potential) {
+        return runAStar(graph, source, target, potential, [](int, int) { return true; });
+    }
+
+    // As above, skipping edges (from, to) for which allowEdge returns false
+    template <typename Potential, typename EdgeFilter>
+    int runAStar(const CSRGraph& graph, int source, int target, Potential&& potential,
+        EdgeFilter&& allowEdge) {
+        beginQuery(graph.numVertices());
+        const int sourceBound = potential(source);
+        if (sourceBound == INF) return INF;
+        setLabel(source, 0, -1);
+        push(sourceBound, source);
+
+        while (!empty()) {
+            auto [key, current] = pop();
+            const int dist = distance[current];
+            if (key > dist + potential(current)) continue;
+            settled++;
+            if (current == target) break;
+
+            for (auto e = graph.edgeBegin(current), last = graph.edgeEnd(current); e < last; ++e) {
+                int next = graph.target(e);
+                int candidate = dist + graph.weight(e);
+                if (candidate < getDistance(next) && allowEdge(current, next)) {
+                    int bound = potential(next);
+                    if (bound == INF) continue;
+                    setLabel(next, candidate, current);
+                    push(candidate + bound, next);
+                }
+            }
+        }
+
+        return getDistance(target);
+    }
+
+    // Dense vertex path from the query source to target, empty if unreached
+    // or at NEGATIVE_INF
+    std::vector<int> extractPath(int target) const;
+    // Joins a forward path to meeting with the backward parent chain from
+    // meeting to the backward search's source
+    static std::vector<int> joinPaths(const DijkstraWorkspace& forward,
+        const DijkstraWorkspace& backward, int meeting);
+    // Vertices settled (popped with a final distance) in the last query
+    size_t settledVertices() const { return settled; }
+};
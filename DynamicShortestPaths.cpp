@@ -0,0 +1,64 @@
+// File: src/DynamicShortestPaths.cpp
+#include "DynamicShortestPaths.h"
+#include <algorithm>
+#include <functional>
+
+DynamicShortestPaths::DynamicShortestPaths(const AdjacencyList& adjacency, int source)
+    : source(source) {
+    grow(adjacency.size());
+    distance[source] = 0;
+    heap.push_back({ 0, source });
+    propagate(adjacency);
+}
+
+void DynamicShortestPaths::grow(size_t vertexCount) {
+    if (distance.size() < vertexCount) {
+        distance.resize(vertexCount, INF);
+        parent.resize(vertexCount, -1);
+    }
+}
+
+void DynamicShortestPaths::seed(const AdjacencyList& adjacency, int from, int to, int weight) {
+    grow(adjacency.size());
+    if (distance[from] == INF) return;
+    int candidate = distance[from] + weight;
+    if (candidate < distance[to]) {
+        distance[to] = candidate;
+        parent[to] = from;
+        heap.push_back({ candidate, to });
+        std::push_heap(heap.begin(), heap.end(), std::greater<>());
+    }
+}
+
+size_t DynamicShortestPaths::propagate(const AdjacencyList& adjacency) {
+    grow(adjacency.size());
+    size_t lowered = 0;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        auto [dist, current] = heap.back();
+        heap.pop_back();
+        if (dist > distance[current]) continue;
+        lowered++;
+
+        for (const auto& [next, weight] : adjacency[current]) {
+            int candidate = dist + weight;
+            if (candidate < distance[next]) {
+                distance[next] = candidate;
+                parent[next] = current;
+                heap.push_back({ candidate, next });
+                std::push_heap(heap.begin(), heap.end(), std::greater<>());
+            }
+        }
+    }
+    return lowered;
+}
+
+std::vector<int> DynamicShortestPaths::pathTo(int target) const {
+    std::vector<int> path;
+    if (getDistance(target) == INF) return path;
+    for (int at = target; at != -1; at = parent[at]) {
+        path.push_back(at);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
@@ -0,0 +1,53 @@
+// File: include/DynamicShortestPaths.h
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Single-source shortest path tree kept current while edges are inserted or
+// their weights decreased. Such updates can only shorten distances, so an
+// update seeds the edge's head if the edge improves it and then runs Dijkstra
+// outward from the improved vertices only. The work is proportional to the
+// vertices whose distance actually changes (plus their out-edges), not to the
+// size of the graph. Weights must be non-negative.
+class DynamicShortestPaths {
+public:
+    using AdjacencyList = std::vector<std::vector<std::pair<int, int>>>;
+    static constexpr int INF = std::numeric_limits<int>::max();
+
+private:
+    int source;
+    std::vector<int> distance;
+    std::vector<int> parent;
+    // Pending (distance, vertex) entries of improved vertices
+    std::vector<std::pair<int, int>> heap;
+
+    void grow(size_t vertexCount);
+
+public:
+    // Computes the initial tree over the dense adjacency list
+    DynamicShortestPaths(const AdjacencyList& adjacency, int source);
+
+    // Records that from -> to now exists with weight (a new edge or a
+    // decreased weight). Call propagate to finish the update.
+    void seed(const AdjacencyList& adjacency, int from, int to, int weight);
+    // Settles everything reachable from the seeded improvements; returns the
+    // number of distance labels lowered
+    size_t propagate(const AdjacencyList& adjacency);
+    size_t insertEdge(const AdjacencyList& adjacency, int from, int to, int weight) {
+        seed(adjacency, from, to, weight);
+        return propagate(adjacency);
+    }
+
+    int getSource() const { return source; }
+    int getDistance(int vertex) const {
+        return static_cast<size_t>(vertex) < distance.size() ? distance[vertex] : INF;
+    }
+    int getParent(int vertex) const {
+        return static_cast<size_t>(vertex) < parent.size() ? parent[vertex] : -1;
+    }
+    // Dense path from source to target, empty if unreachable
+    std::vector<int> pathTo(int target) const;
+};
@@ -0,0 +1,240 @@
+// File: src/EdgeListLoader.cpp
+#include "EdgeListLoader.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include "MappedFile.h"
+#include "ParallelExecutor.h"
+
+namespace {
+    using Edge = GraphAnalysisTool::Edge;
+
+    // Which mirrored entry each off-diagonal entry implies
+    enum class Symmetry {
+        GENERAL,        // None
+        SYMMETRIC,      // Same weight (also undirected edge lists)
+        SKEW_SYMMETRIC  // Negated weight
+    };
+
+    bool isSeparator(char c) {
+        return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+    }
+
+    const char* skipSeparators(const char* p, const char* end) {
+        while (p < end && isSeparator(*p)) p++;
+        return p;
+    }
+
+    bool isComment(const char* p, const char* end) {
+        return *p == '#' || *p == '%' || (*p == '/' && p + 1 < end && p[1] == '/');
+    }
+
+    // Parses a single line [p, end) into edge. Returns false for comments,
+    // blank lines and lines that do not start with two integer IDs.
+    bool parseLine(const char* p, const char* end, int defaultWeight, Edge& edge) {
+        p = skipSeparators(p, end);
+        if (p == end || isComment(p, end)) return false;
+
+        auto fromResult = std::from_chars(p, end, edge.from);
+        if (fromResult.ec != std::errc() || fromResult.ptr == end || !isSeparator(*fromResult.ptr)) {
+            return false;
+        }
+        p = skipSeparators(fromResult.ptr, end);
+        auto toResult = std::from_chars(p, end, edge.to);
+        if (toResult.ec != std::errc() || (toResult.ptr < end && !isSeparator(*toResult.ptr))) {
+            return false;
+        }
+        p = skipSeparators(toResult.ptr, end);
+
+        edge.weight = defaultWeight;
+        if (p < end) {
+            auto weightResult = std::from_chars(p, end, edge.weight);
+            if (weightResult.ec != std::errc() ||
+                (weightResult.ptr < end && !isSeparator(*weightResult.ptr))) {
+                // Real-valued weights (e.g. Matrix Market "real") are rounded;
+                // ones that do not fit in an int make the line malformed
+                double value = 0;
+                auto realResult = std::from_chars(p, end, value);
+                if (realResult.ec != std::errc() ||
+                    (realResult.ptr < end && !isSeparator(*realResult.ptr))) {
+                    return false;
+                }
+                value = std::round(value);
+                if (!(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())) {
+                    return false;
+                }
+                edge.weight = static_cast<int>(value);
+            }
+        }
+        return true;
+    }
+
+    void parseRange(const char* begin, const char* end, int defaultWeight, Symmetry symmetry,
+        std::vector<Edge>& edges, size_t& skipped) {
+        edges.reserve(edges.size() + static_cast<size_t>(end - begin) / 16);
+        Edge edge;
+        for (const char* line = begin; line < end;) {
+            const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+            const char* lineEnd = newline ? newline : end;
+            bool parsed = parseLine(line, lineEnd, defaultWeight, edge);
+            // INT_MIN has no negation in an int
+            if (parsed && symmetry == Symmetry::SKEW_SYMMETRIC &&
+                edge.weight == std::numeric_limits<int>::min()) {
+                parsed = false;
+            }
+            if (parsed) {
+                edges.push_back(edge);
+                if (symmetry != Symmetry::GENERAL && edge.from != edge.to) {
+                    int mirrored = symmetry == Symmetry::SKEW_SYMMETRIC ? -edge.weight : edge.weight;
+                    edges.push_back({ edge.to, edge.from, mirrored });
+                }
+            }
+            else if (skipSeparators(line, lineEnd) != lineEnd) {
+                skipped++;
+            }
+            line = lineEnd + 1;
+        }
+    }
+
+    // Symmetry field of a "%%MatrixMarket matrix coordinate <field> <symmetry>"
+    // banner. Hermitian matrices mirror the conjugate, whose real part (the
+    // part kept as the weight) is the same, so they mirror like symmetric.
+    Symmetry parseSymmetry(const std::string& banner) {
+        std::istringstream tokens(banner);
+        std::string fields[5];
+        for (std::string& field : fields) tokens >> field;
+        std::string symmetry = fields[4];
+        std::transform(symmetry.begin(), symmetry.end(), symmetry.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (symmetry.empty() || symmetry == "general") return Symmetry::GENERAL;
+        if (symmetry == "symmetric" || symmetry == "hermitian") return Symmetry::SYMMETRIC;
+        if (symmetry == "skew-symmetric") return Symmetry::SKEW_SYMMETRIC;
+        throw std::runtime_error("Unsupported Matrix Market symmetry: " + fields[4]);
+    }
+
+    // Consumes the Matrix Market banner, comments and size line, returning the
+    // start of the entries and setting symmetry from the banner
+    const char* skipMatrixMarketHeader(const char* data, const char* end, Symmetry& symmetry) {
+        static const char prefix[] = "%%MatrixMarket";
+        const char* line = data;
+        bool sizeLineSeen = false;
+        while (line < end && !sizeLineSeen) {
+            const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+            const char* lineEnd = newline ? newline : end;
+            const char* p = skipSeparators(line, lineEnd);
+            if (p < lineEnd && *p == '%') {
+                if (line == data && lineEnd - line >= static_cast<std::ptrdiff_t>(sizeof(prefix) - 1) &&
+                    std::memcmp(line, prefix, sizeof(prefix) - 1) == 0) {
+                    symmetry = parseSymmetry(std::string(line, lineEnd));
+                }
+            }
+            else if (p < lineEnd) {
+                sizeLineSeen = true;
+            }
+            line = lineEnd + 1;
+        }
+        return std::min(line, end);
+    }
+}
+
+EdgeListLoader::ParseResult EdgeListLoader::parseBuffer(const char* data, size_t size,
+    const Options& options) {
+    ParseResult result;
+    result.bytesParsed = size;
+    if (size == 0) return result;
+
+    const char* end = data + size;
+    Symmetry symmetry = options.undirected ? Symmetry::SYMMETRIC : Symmetry::GENERAL;
+    Format format = options.format;
+    if (format == Format::AUTO) {
+        static const char banner[] = "%%MatrixMarket";
+        bool hasBanner = size >= sizeof(banner) - 1 &&
+            std::memcmp(data, banner, sizeof(banner) - 1) == 0;
+        format = hasBanner ? Format::MATRIX_MARKET : Format::EDGE_LIST;
+    }
+
+    const char* begin = data;
+    if (format == Format::MATRIX_MARKET) {
+        Symmetry banner = Symmetry::GENERAL;
+        begin = skipMatrixMarketHeader(data, end, banner);
+        if (banner != Symmetry::GENERAL) symmetry = banner;
+    }
+
+    // Split into newline-aligned chunks so every line belongs to exactly one
+    const size_t remaining = static_cast<size_t>(end - begin);
+    const size_t chunkBytes = std::max<size_t>(options.chunkBytes, 1);
+    const size_t chunks = std::max<size_t>(1, (remaining + chunkBytes - 1) / chunkBytes);
+    std::vector<const char*> bounds(chunks + 1, end);
+    bounds[0] = begin;
+    for (size_t c = 1; c < chunks; c++) {
+        const char* cut = std::max(bounds[c - 1], begin + remaining / chunks * c);
+        const char* newline = static_cast<const char*>(std::memchr(cut, '\n', end - cut));
+        bounds[c] = newline ? newline + 1 : end;
+    }
+
+    std::vector<std::vector<Edge>> chunkEdges(chunks);
+    std::vector<size_t> chunkSkipped(chunks, 0);
+    ParallelExecutor::forEachChunk(chunks, 1, [&](size_t first, size_t last, unsigned) {
+        for (size_t c = first; c < last; c++) {
+            parseRange(bounds[c], bounds[c + 1], options.defaultWeight, symmetry, chunkEdges[c], chunkSkipped[c]);
+        }
+    });
+
+    // Concatenate the per-chunk results in file order
+    std::vector<size_t> offsets(chunks + 1, 0);
+    for (size_t c = 0; c < chunks; c++) {
+        offsets[c + 1] = offsets[c] + chunkEdges[c].size();
+        result.linesSkipped += chunkSkipped[c];
+    }
+    result.edges.resize(offsets[chunks]);
+    ParallelExecutor::forEachChunk(chunks, 1, [&](size_t first, size_t last, unsigned) {
+        for (size_t c = first; c < last; c++) {
+            std::copy(chunkEdges[c].begin(), chunkEdges[c].end(), result.edges.begin() + offsets[c]);
+            std::vector<Edge>().swap(chunkEdges[c]);
+        }
+    });
+    return result;
+}
+
+EdgeListLoader::ParseResult EdgeListLoader::parse(const std::string& filename, const Options& options) {
+    MappedFile file(filename);
+    return parseBuffer(file.data(), file.size(), options);
+}
+
+void EdgeListLoader::loadInto(GraphAnalysisTool& graph, const std::string& filename,
+    const Options& options) {
+    const std::string operation = "Edge List Load";
+    ParseResult parsed;
+    double parseSeconds = 0;
+    {
+        Timer timer(operation, graph);
+        auto start = std::chrono::high_resolution_clock::now();
+        parsed = parse(filename, options);
+        parseSeconds = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        graph.addEdges(parsed.edges);
+    }
+
+    PerformanceMetrics& metric = graph.metrics[operation];
+    const double totalSeconds = metric.executionTime.count();
+    const double megabytes = parsed.bytesParsed / (1024.0 * 1024.0);
+    metric.nodesProcessed = parsed.edges.size();
+    metric.counters["Bytes Parsed"] = static_cast<double>(parsed.bytesParsed);
+    metric.counters["Lines Skipped"] = static_cast<double>(parsed.linesSkipped);
+    metric.counters["Parse Throughput (MB/s)"] = parseSeconds > 0 ? megabytes / parseSeconds : 0;
+    metric.counters["Load Throughput (edges/s)"] =
+        totalSeconds > 0 ? parsed.edges.size() / totalSeconds : 0;
+}
+
+GraphAnalysisTool EdgeListLoader::load(const std::string& filename, const Options& options) {
+    GraphAnalysisTool graph;
+    loadInto(graph, filename, options);
+    return graph;
+}
@@ -7,28 +7,259 @@
 #include <iomanip>
 #include <algorithm>
 #include <limits>
+#include "AllPairsShortestPaths.h"
+#include "BinaryGraphFormat.h"
+#include "DeltaStepping.h"
+#include "KShortestPaths.h"
+#include "MultiSourceBFS.h"
+#include "ParallelExecutor.h"
+
+GraphAnalysisTool::GraphAnalysisTool()
+    : materialized(true), numEdges(0), version(0), connectivityTracked(false) {}
+
+GraphAnalysisTool::GraphAnalysisTool(std::shared_ptr<const CSRGraph> frozen)
+    : materialized(false), numEdges(static_cast<int>(frozen->numEdges())), snapshot(std::move(frozen)),
+    version(0), connectivityTracked(false) {}
+
+void GraphAnalysisTool::materialize() const {
+    if (materialized) return;
+    const CSRGraph& graph = *snapshot;
+    idMap.reserve(graph.numVertices());
+    adjacencyList.assign(graph.numVertices(), {});
+    reverseAdjacencyList.assign(graph.numVertices(), {});
+    for (int v = 0; v < graph.numVertices(); v++) {
+        idMap.insert(graph.toExternal(v));
+        adjacencyList[v].reserve(graph.degree(v));
+        for (auto e = graph.edgeBegin(v), last = graph.edgeEnd(v); e < last; ++e) {
+            adjacencyList[v].push_back({ graph.target(e), graph.weight(e) });
+        }
+        reverseAdjacencyList[v].reserve(graph.inDegree(v));
+        for (auto e = graph.inEdgeBegin(v), last = graph.inEdgeEnd(v); e < last; ++e) {
+            reverseAdjacencyList[v].push_back({ graph.source(e), graph.inWeight(e) });
+        }
+    }
+    materialized = true;
+}
 
-GraphAnalysisTool::GraphAnalysisTool() : numNodes(0), numEdges(0) {}
-
-void GraphAnalysisTool::addEdge(int from, int to, int weight) {
+void GraphAnalysisTool::addEdge(NodeId from, NodeId to, int weight) {
     // Add both nodes to ensure they're tracked
     addNode(from);
     addNode(to);
 
-    adjacencyList[from].push_back({ to, weight });
+    int source = idMap.toDense(from);
+    int target = idMap.toDense(to);
+    // An edge between vertices that are already connected that way leaves
+    // reachability unchanged, so the index survives it
+    std::shared_ptr<const ReachabilityIndex> keptReachability;
+    if (reachability && reachability->reachable(source, target, reachabilityState)) {
+        keptReachability = reachability;
+    }
+    adjacencyList[source].push_back({ target, weight });
+    reverseAdjacencyList[target].push_back({ source, weight });
     numEdges++;
+    invalidateSnapshot();
+    reachability = std::move(keptReachability);
+
+    if (weight < 0) dropTrackedSources();
+    if (!trackedSources.empty()) {
+        size_t lowered = 0;
+        for (auto& tracked : trackedSources) {
+            lowered += tracked.insertEdge(adjacencyList, source, target, weight);
+        }
+        metrics["Dynamic SSSP"].nodesProcessed += lowered;
+    }
+    if (labelPropagation.isInitialized()) {
+        labelPropagation.touch(source);
+        labelPropagation.touch(target);
+    }
+    if (connectivityTracked) connectivity.unite(source, target);
+}
+
+bool GraphAnalysisTool::decreaseEdgeWeight(NodeId from, NodeId to, int weight) {
+    materialize();
+    int source = idMap.toDense(from);
+    int target = idMap.toDense(to);
+    if (source < 0 || target < 0) return false;
+
+    auto lower = [weight](std::vector<std::pair<int, int>>& row, int other) {
+        for (auto& [end, edgeWeight] : row) {
+            if (end == other && edgeWeight > weight) {
+                edgeWeight = weight;
+                return true;
+            }
+        }
+        return false;
+    };
+    if (!lower(adjacencyList[source], target)) return false;
+    lower(reverseAdjacencyList[target], source);
+    // Weights do not affect reachability
+    std::shared_ptr<const ReachabilityIndex> keptReachability = reachability;
+    invalidateSnapshot();
+    reachability = std::move(keptReachability);
+    if (labelPropagation.isInitialized()) {
+        labelPropagation.touch(source);
+        labelPropagation.touch(target);
+    }
+
+    if (weight < 0) dropTrackedSources();
+    if (!trackedSources.empty()) {
+        size_t lowered = 0;
+        for (auto& tracked : trackedSources) {
+            lowered += tracked.insertEdge(adjacencyList, source, target, weight);
+        }
+        metrics["Dynamic SSSP"].nodesProcessed += lowered;
+    }
+    return true;
+}
+
+namespace {
+    // Appends (others[i], weight of edge i) to rows[keys[i]] for every edge.
+    // Edges are bucketed by key range so each thread owns a disjoint set of
+    // rows, and within a row the original edge order is preserved.
+    void appendRows(std::vector<std::vector<std::pair<int, int>>>& rows,
+        const std::vector<int>& keys, const std::vector<int>& others,
+        const GraphAnalysisTool::Edge* edges) {
+        const size_t count = keys.size();
+        const size_t vertexCount = rows.size();
+        const size_t chunks = std::min<size_t>(ParallelExecutor::threadCount(), (count + 4095) / 4096);
+        const size_t buckets = std::max<size_t>(1, std::min(chunks * 4, vertexCount));
+        const size_t chunkSize = (count + chunks - 1) / chunks;
+        auto bucketOf = [&](int key) { return static_cast<size_t>(key) * buckets / vertexCount; };
+
+        // Per-chunk bucket histograms
+        std::vector<size_t> counts(chunks * buckets, 0);
+        ParallelExecutor::forEachChunk(chunks, 1, [&](size_t first, size_t last, unsigned) {
+            for (size_t c = first; c < last; c++) {
+                size_t end = std::min(count, (c + 1) * chunkSize);
+                for (size_t i = c * chunkSize; i < end; i++) {
+                    counts[c * buckets + bucketOf(keys[i])]++;
+                }
+            }
+        });
+
+        // Exclusive prefix sum in bucket-major order gives each chunk a
+        // private, order-preserving output range within every bucket
+        std::vector<size_t> bucketStart(buckets + 1, 0);
+        size_t position = 0;
+        for (size_t b = 0; b < buckets; b++) {
+            bucketStart[b] = position;
+            for (size_t c = 0; c < chunks; c++) {
+                size_t n = counts[c * buckets + b];
+                counts[c * buckets + b] = position;
+                position += n;
+            }
+        }
+        bucketStart[buckets] = position;
+
+        std::vector<size_t> order(count);
+        ParallelExecutor::forEachChunk(chunks, 1, [&](size_t first, size_t last, unsigned) {
+            for (size_t c = first; c < last; c++) {
+                size_t end = std::min(count, (c + 1) * chunkSize);
+                for (size_t i = c * chunkSize; i < end; i++) {
+                    order[counts[c * buckets + bucketOf(keys[i])]++] = i;
+                }
+            }
+        });
+
+        // Each bucket counts the new degree of its rows, reserves them exactly
+        // and then appends in edge order
+        std::vector<size_t> added(vertexCount, 0);
+        ParallelExecutor::forEachChunk(buckets, 1, [&](size_t first, size_t last, unsigned) {
+            for (size_t k = bucketStart[first]; k < bucketStart[last]; k++) {
+                added[keys[order[k]]]++;
+            }
+            for (size_t k = bucketStart[first]; k < bucketStart[last]; k++) {
+                int key = keys[order[k]];
+                if (added[key] > 0) {
+                    rows[key].reserve(rows[key].size() + added[key]);
+                    added[key] = 0;
+                }
+                rows[key].push_back({ others[order[k]], edges[order[k]].weight });
+            }
+        });
+    }
+
+    // Each shortest path algorithm is reported under its own metrics entry
+    std::string pathMetricName(GraphAnalysisTool::PathAlgorithm algorithm) {
+        switch (algorithm) {
+        case GraphAnalysisTool::PathAlgorithm::BIDIRECTIONAL:
+            return "Shortest Path (Bidirectional)";
+        case GraphAnalysisTool::PathAlgorithm::ALT:
+            return "Shortest Path (ALT)";
+        case GraphAnalysisTool::PathAlgorithm::CONTRACTION_HIERARCHY:
+            return "Shortest Path (CH)";
+        default:
+            return "Shortest Path";
+        }
+    }
+}
+
+void GraphAnalysisTool::addEdges(const Edge* edges, size_t count) {
+    Timer timer("Bulk Edge Load", *this);
+    if (count == 0) return;
+    materialize();
+
+    // Endpoint registration is sequential since it assigns dense indices
+    std::vector<int> sources(count);
+    std::vector<int> targets(count);
+    for (size_t i = 0; i < count; i++) {
+        sources[i] = idMap.insert(edges[i].from);
+        targets[i] = idMap.insert(edges[i].to);
+    }
+
+    adjacencyList.resize(idMap.size());
+    reverseAdjacencyList.resize(idMap.size());
+    appendRows(adjacencyList, sources, targets, edges);
+    appendRows(reverseAdjacencyList, targets, sources, edges);
+
+    numEdges += static_cast<int>(count);
+    metrics["Bulk Edge Load"].nodesProcessed = count;
+    invalidateSnapshot();
+
+    for (size_t i = 0; i < count && !trackedSources.empty(); i++) {
+        if (edges[i].weight < 0) dropTrackedSources();
+    }
+    if (!trackedSources.empty()) {
+        // Seed every improving edge first so each tree is settled in one pass
+        size_t lowered = 0;
+        for (auto& tracked : trackedSources) {
+            for (size_t i = 0; i < count; i++) {
+                tracked.seed(adjacencyList, sources[i], targets[i], edges[i].weight);
+            }
+            lowered += tracked.propagate(adjacencyList);
+        }
+        metrics["Dynamic SSSP"].nodesProcessed += lowered;
+    }
+    if (labelPropagation.isInitialized()) {
+        for (size_t i = 0; i < count; i++) {
+            labelPropagation.touch(sources[i]);
+            labelPropagation.touch(targets[i]);
+        }
+    }
+    if (connectivityTracked) {
+        connectivity.grow(idMap.size());
+        for (size_t i = 0; i < count; i++) {
+            connectivity.unite(sources[i], targets[i]);
+        }
+    }
+}
+
+void GraphAnalysisTool::addEdges(const std::vector<Edge>& edges) {
+    addEdges(edges.data(), edges.size());
 }
 
 std::string GraphAnalysisTool::printGraphStructure() const {
+    materialize();
     std::stringstream ss;
-    ss << "Graph has " << numNodes << " nodes and " << numEdges << " edges.\n";
+    ss << "Graph has " << idMap.size() << " nodes and " << numEdges << " edges.\n";
     ss << "Adjacency List:\n";
 
-    for (const auto& [node, neighbors] : adjacencyList) {
-        ss << "Node " << node << " -> [";
+    for (int node = 0; node < idMap.size(); node++) {
+        const auto& neighbors = adjacencyList[node];
+        ss << "Node " << idMap.toExternal(node) << " -> [";
         for (size_t i = 0; i < neighbors.size(); ++i) {
             const auto& [dest, weight] = neighbors[i];
-            ss << "(Node " << dest << ", Weight " << weight << ")";
+            ss << "(Node " << idMap.toExternal(dest) << ", Weight " << weight << ")";
             if (i < neighbors.size() - 1) ss << ", ";
         }
         ss << "]\n";
@@ -36,12 +267,117 @@ std::string GraphAnalysisTool::printGraphStructure() const {
     return ss.str();
 }
 
-std::string GraphAnalysisTool::findShortestPath(int start, int end) {
-    Timer timer("Shortest Path", *this);
+void GraphAnalysisTool::invalidateSnapshot() {
+    snapshot.reset();
+    landmarks.reset();
+    hierarchy.reset();
+    reachability.reset();
+    version++;
+}
+
+void GraphAnalysisTool::enablePathCache(size_t maxTrees) {
+    pathCache.setCapacity(maxTrees);
+}
+
+void GraphAnalysisTool::trackSource(NodeId source) {
+    materialize();
+    int dense = idMap.toDense(source);
+    if (dense < 0 || findTracked(dense)) return;
+    // Incremental updates need non-negative weights
+    for (const auto& row : adjacencyList) {
+        for (const auto& edge : row) {
+            if (edge.second < 0) return;
+        }
+    }
+    Timer timer("Dynamic SSSP Initialization", *this);
+    trackedSources.emplace_back(adjacencyList, dense);
+    metrics["Dynamic SSSP Initialization"].nodesProcessed = idMap.size();
+}
+
+void GraphAnalysisTool::untrackSource(NodeId source) {
+    int dense = idMap.toDense(source);
+    trackedSources.erase(std::remove_if(trackedSources.begin(), trackedSources.end(),
+        [dense](const DynamicShortestPaths& tracked) { return tracked.getSource() == dense; }),
+        trackedSources.end());
+}
+
+void GraphAnalysisTool::dropTrackedSources() {
+    metrics["Dynamic SSSP"].counters["Dropped Trees"] += static_cast<double>(trackedSources.size());
+    trackedSources.clear();
+}
+
+const DynamicShortestPaths* GraphAnalysisTool::findTracked(int source) const {
+    for (const auto& tracked : trackedSources) {
+        if (tracked.getSource() == source) return &tracked;
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const CSRGraph> GraphAnalysisTool::freeze() {
+    if (!snapshot) {
+        Timer timer("Freeze", *this);
+        snapshot = std::make_shared<const CSRGraph>(adjacencyList, reverseAdjacencyList,
+            idMap.getExternalIds());
+        metrics["Freeze"].nodesProcessed = idMap.size();
+    }
+    return snapshot;
+}
+
+void GraphAnalysisTool::saveBinary(const std::string& filename) {
+    Timer timer("Binary Save", *this);
+    auto frozen = freeze();
+    BinaryGraphFormat::write(*frozen, filename);
+    metrics["Binary Save"].nodesProcessed = frozen->numVertices();
+}
+
+GraphAnalysisTool GraphAnalysisTool::loadBinary(const std::string& filename) {
+    auto start = std::chrono::high_resolution_clock::now();
+    GraphAnalysisTool graph(BinaryGraphFormat::open(filename));
+    auto& metric = graph.metrics["Binary Load"];
+    metric.executionTime = std::chrono::high_resolution_clock::now() - start;
+    metric.nodesProcessed = graph.snapshot->numVertices();
+    return graph;
+}
+
+std::vector<NodeId> GraphAnalysisTool::toExternalPath(const CSRGraph& graph, const std::vector<int>& path) {
+    std::vector<NodeId> external;
+    external.reserve(path.size());
+    for (int v : path) {
+        external.push_back(graph.toExternal(v));
+    }
+    return external;
+}
+
+BreadthFirstSearch::Result GraphAnalysisTool::breadthFirstSearch(NodeId source) {
+    auto frozen = freeze();
+    Timer timer("BFS", *this);
+    BreadthFirstSearch::Result result = BreadthFirstSearch::run(*frozen, frozen->toDense(source));
+
+    PerformanceMetrics& metric = metrics["BFS"];
+    size_t reached = 0;
+    for (size_t size : result.levelSizes) reached += size;
+    metric.nodesProcessed = reached;
+    metric.counters["Levels"] = static_cast<double>(result.levelSizes.size());
+    metric.counters["Top-Down Steps"] = static_cast<double>(result.topDownSteps);
+    metric.counters["Bottom-Up Steps"] = static_cast<double>(result.bottomUpSteps);
+    return result;
+}
+
+std::vector<int> GraphAnalysisTool::hopDistances(NodeId source) {
+    return breadthFirstSearch(source).depth;
+}
+
+std::string GraphAnalysisTool::findShortestPath(NodeId start, NodeId end, PathAlgorithm algorithm) {
+    Timer timer(pathMetricName(algorithm), *this);
     std::stringstream ss;
 
-    auto [path, distance] = shortestPath(start, end);
+    auto [path, distance] = shortestPath(start, end, algorithm);
 
+    if (distance == DijkstraWorkspace::NEGATIVE_INF) {
+        ss << "No shortest path from Node " << start << " to Node " << end
+            << ": a negative cycle lies on the way\n";
+        return ss.str();
+    }
     if (path.empty()) {
         ss << "No path exists between Node " << start << " and Node " << end << "\n";
         return ss.str();
@@ -57,55 +393,276 @@ std::string GraphAnalysisTool::findShortestPath(int start, int end) {
     return ss.str();
 }
 
-std::pair<std::vector<int>, int> GraphAnalysisTool::shortestPath(int start, int end) {
-    std::vector<int> distances(numNodes, std::numeric_limits<int>::max());
-    std::vector<int> previous(numNodes, -1);
-    std::priority_queue<std::pair<int, int>,
-        std::vector<std::pair<int, int>>,
-        std::greater<>> pq;
+void GraphAnalysisTool::preprocessLandmarks(int landmarkCount) {
+    auto frozen = freeze();
+    Timer timer("Landmark Preprocessing", *this);
+    landmarks = std::make_shared<const LandmarkIndex>(*frozen, landmarkCount);
 
-    distances[start] = 0;
-    pq.push({ 0, start });
-    metrics["Shortest Path"].nodesProcessed = 0;
+    PerformanceMetrics& metric = metrics["Landmark Preprocessing"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Landmarks"] = static_cast<double>(landmarks->getLandmarks().size());
+    metric.counters["Table Memory (KB)"] = landmarks->memoryFootprint() / 1024.0;
+}
+
+void GraphAnalysisTool::buildContractionHierarchy() {
+    auto frozen = freeze();
+    Timer timer("Contraction Hierarchy Build", *this);
+    hierarchy = std::make_shared<const ContractionHierarchy>(*frozen);
 
-    while (!pq.empty()) {
-        int current = pq.top().second;
-        int dist = pq.top().first;
-        pq.pop();
-        metrics["Shortest Path"].nodesProcessed++;
+    PerformanceMetrics& metric = metrics["Contraction Hierarchy Build"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Shortcuts"] = static_cast<double>(hierarchy->numShortcuts());
+    metric.counters["Index Memory (KB)"] = hierarchy->memoryFootprint() / 1024.0;
+}
 
-        if (dist > distances[current]) continue;
+HierarchyQuery GraphAnalysisTool::createHierarchyQuery() {
+    auto frozen = freeze();
+    if (!hierarchy) buildContractionHierarchy();
+    return HierarchyQuery(frozen, hierarchy);
+}
+
+void GraphAnalysisTool::saveContractionHierarchy(const std::string& filename) {
+    if (!hierarchy) buildContractionHierarchy();
+    hierarchy->save(filename);
+}
+
+void GraphAnalysisTool::loadContractionHierarchy(const std::string& filename) {
+    auto frozen = freeze();
+    hierarchy = ContractionHierarchy::load(filename, *frozen);
+}
 
-        for (const auto& [next, weight] : adjacencyList[current]) {
-            if (distances[current] + weight < distances[next]) {
-                distances[next] = distances[current] + weight;
-                previous[next] = current;
-                pq.push({ distances[next], next });
+std::pair<std::vector<NodeId>, int> GraphAnalysisTool::shortestPath(NodeId startNode, NodeId endNode) {
+    return shortestPath(startNode, endNode, PathAlgorithm::DIJKSTRA);
+}
+
+std::pair<std::vector<NodeId>, int> GraphAnalysisTool::shortestPath(NodeId startNode, NodeId endNode,
+    PathAlgorithm algorithm) {
+    // A tracked tree is already current, so answer it from the adjacency
+    // lists' ID map without paying for a new snapshot after mutations
+    if (algorithm == PathAlgorithm::DIJKSTRA && !trackedSources.empty()) {
+        int source = idMap.toDense(startNode);
+        if (const DynamicShortestPaths* tracked = source < 0 ? nullptr : findTracked(source)) {
+            metrics[pathMetricName(algorithm)].nodesProcessed = 0;
+            int target = idMap.toDense(endNode);
+            if (target < 0) return { {}, std::numeric_limits<int>::max() };
+            std::vector<NodeId> path;
+            for (int v : tracked->pathTo(target)) {
+                path.push_back(idMap.toExternal(v));
             }
+            return { path, tracked->getDistance(target) };
         }
     }
 
-    std::vector<int> path;
-    if (distances[end] != std::numeric_limits<int>::max()) {
-        for (int at = end; at != -1; at = previous[at]) {
-            path.push_back(at);
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    int start = graph.toDense(startNode);
+    int end = graph.toDense(endNode);
+    if (start < 0 || end < 0) {
+        return { {}, std::numeric_limits<int>::max() };
+    }
+
+    // The specialised searches assume non-negative weights; with a negative
+    // one the plain search answers with its Bellman-Ford fallback
+    const bool negativeWeights = graph.minWeight() < 0;
+
+    if (algorithm == PathAlgorithm::ALT && !negativeWeights) {
+        if (!landmarks) preprocessLandmarks();
+        int distance = landmarks->query(graph, start, end, pathWorkspace);
+        metrics[pathMetricName(algorithm)].nodesProcessed = pathWorkspace.settledVertices();
+        return { toExternalPath(graph, pathWorkspace.extractPath(end)), distance };
+    }
+
+    if (algorithm == PathAlgorithm::CONTRACTION_HIERARCHY && !negativeWeights) {
+        if (!hierarchy) buildContractionHierarchy();
+        std::vector<int> path;
+        int distance = hierarchy->query(start, end, pathWorkspace, reversePathWorkspace, &path);
+        metrics[pathMetricName(algorithm)].nodesProcessed =
+            pathWorkspace.settledVertices() + reversePathWorkspace.settledVertices();
+        return { toExternalPath(graph, path), distance };
+    }
+
+    PerformanceMetrics& metric = metrics[pathMetricName(algorithm)];
+    if (algorithm == PathAlgorithm::BIDIRECTIONAL && !negativeWeights) {
+        int meeting = -1;
+        int distance = DijkstraWorkspace::runBidirectional(graph, start, end,
+            pathWorkspace, reversePathWorkspace, meeting);
+        metric.nodesProcessed = pathWorkspace.settledVertices() + reversePathWorkspace.settledVertices();
+        metric.counters["Forward Settled"] = static_cast<double>(pathWorkspace.settledVertices());
+        metric.counters["Backward Settled"] = static_cast<double>(reversePathWorkspace.settledVertices());
+        return { toExternalPath(graph, DijkstraWorkspace::joinPaths(pathWorkspace, reversePathWorkspace, meeting)),
+            distance };
+    }
+
+    if (pathCache.enabled()) {
+        const ShortestPathCache::Tree* tree = pathCache.find(start, version);
+        if (tree) {
+            metric.nodesProcessed = 0;
         }
-        std::reverse(path.begin(), path.end());
+        else {
+            pathWorkspace.run(graph, start, -1);
+            metric.nodesProcessed = pathWorkspace.settledVertices();
+            ShortestPathCache::Tree built;
+            built.distance.resize(graph.numVertices());
+            built.parent.resize(graph.numVertices());
+            for (int v = 0; v < graph.numVertices(); v++) {
+                built.distance[v] = pathWorkspace.getDistance(v);
+                built.parent[v] = pathWorkspace.getParent(v);
+            }
+            tree = &pathCache.insert(start, version, std::move(built));
+        }
+        metric.counters["Cache Hits"] = static_cast<double>(pathCache.hits());
+        metric.counters["Cache Misses"] = static_cast<double>(pathCache.misses());
+        return { toExternalPath(graph, tree->pathTo(end)), tree->distance[end] };
     }
 
-    return { path, distances[end] };
+    int distance = pathWorkspace.run(graph, start, end);
+    metric.nodesProcessed = pathWorkspace.settledVertices();
+
+    return { toExternalPath(graph, pathWorkspace.extractPath(end)), distance };
 }
 
-void GraphAnalysisTool::dfsUtil(int node, std::set<int>& visited, std::vector<int>& component) {
-    visited.insert(node);
-    component.push_back(node);
-    metrics["Community Detection"].nodesProcessed++;
+std::vector<std::pair<std::vector<NodeId>, int>> GraphAnalysisTool::kShortestPaths(NodeId startNode,
+    NodeId endNode, size_t k) {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    Timer timer("K Shortest Paths", *this);
+
+    KShortestPaths::Stats stats;
+    std::vector<KShortestPaths::Path> paths = KShortestPaths::find(graph, graph.toDense(startNode),
+        graph.toDense(endNode), k, pathWorkspace, reversePathWorkspace, stats);
+
+    std::vector<std::pair<std::vector<NodeId>, int>> result;
+    for (const KShortestPaths::Path& path : paths) {
+        result.emplace_back(toExternalPath(graph, path.vertices), path.distance);
+    }
+
+    PerformanceMetrics& metric = metrics["K Shortest Paths"];
+    metric.nodesProcessed = result.size();
+    metric.counters["Spur Searches"] = static_cast<double>(stats.spurSearches);
+    metric.counters["Tree Spurs"] = static_cast<double>(stats.treeSpurs);
+    return result;
+}
+
+std::vector<int> GraphAnalysisTool::shortestDistances(NodeId source, int delta) {
+    auto frozen = freeze();
+    Timer timer("Delta-Stepping SSSP", *this);
+    DeltaStepping::Result result = DeltaStepping::run(*frozen, frozen->toDense(source), delta);
+
+    PerformanceMetrics& metric = metrics["Delta-Stepping SSSP"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Delta"] = result.delta;
+    metric.counters["Buckets Processed"] = static_cast<double>(result.bucketsProcessed);
+    metric.counters["Edge Relaxations"] = static_cast<double>(result.relaxations);
+    return std::move(result.distances);
+}
 
-    for (const auto& [next, _] : adjacencyList[node]) {
-        if (visited.find(next) == visited.end()) {
-            dfsUtil(next, visited, component);
+GraphAnalysisTool::DistanceMatrix GraphAnalysisTool::distanceMatrix(const std::vector<NodeId>& sources,
+    const std::vector<NodeId>& targets) {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    Timer timer("Distance Matrix", *this);
+
+    DistanceMatrix matrix;
+    matrix.rows = sources.size();
+    matrix.columns = targets.size();
+    matrix.distances.assign(matrix.rows * matrix.columns, std::numeric_limits<int>::max());
+
+    std::vector<int> denseTargets(targets.size());
+    std::vector<char> targetMask(graph.numVertices(), 0);
+    size_t targetCount = 0;
+    for (size_t j = 0; j < targets.size(); j++) {
+        denseTargets[j] = graph.toDense(targets[j]);
+        if (denseTargets[j] >= 0 && !targetMask[denseTargets[j]]) {
+            targetMask[denseTargets[j]] = 1;
+            targetCount++;
         }
     }
+
+    std::vector<DijkstraWorkspace> workspaces(ParallelExecutor::threadCount());
+    std::vector<size_t> settledCounts(workspaces.size(), 0);
+    if (targetCount > 0) {
+        ParallelExecutor::forEachChunk(sources.size(), 1, [&](size_t first, size_t last, unsigned thread) {
+            DijkstraWorkspace& workspace = workspaces[thread];
+            for (size_t i = first; i < last; i++) {
+                int source = graph.toDense(sources[i]);
+                if (source < 0) continue;
+                workspace.runToTargets(graph, source, targetMask, targetCount);
+                settledCounts[thread] += workspace.settledVertices();
+
+                int* row = matrix.distances.data() + i * matrix.columns;
+                for (size_t j = 0; j < denseTargets.size(); j++) {
+                    if (denseTargets[j] >= 0) row[j] = workspace.getDistance(denseTargets[j]);
+                }
+            }
+        });
+    }
+
+    size_t settled = 0;
+    for (size_t count : settledCounts) {
+        settled += count;
+    }
+    PerformanceMetrics& metric = metrics["Distance Matrix"];
+    metric.nodesProcessed = matrix.distances.size();
+    metric.counters["Searches"] = static_cast<double>(sources.size());
+    metric.counters["Vertices Settled"] = static_cast<double>(settled);
+    return matrix;
+}
+
+GraphAnalysisTool::DistanceMatrix GraphAnalysisTool::multiSourceHopDistances(const std::vector<NodeId>& sources) {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    Timer timer("Multi-Source BFS", *this);
+
+    std::vector<int> denseSources(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        denseSources[i] = graph.toDense(sources[i]);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    MultiSourceBFS::Result result = MultiSourceBFS::run(graph, denseSources);
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    DistanceMatrix matrix;
+    matrix.rows = sources.size();
+    matrix.columns = graph.numVertices();
+    matrix.distances = std::move(result.distances);
+
+    PerformanceMetrics& metric = metrics["Multi-Source BFS"];
+    metric.nodesProcessed = sources.size();
+    metric.counters["Batches"] = static_cast<double>(result.batches);
+    metric.counters["Edges Scanned"] = static_cast<double>(result.edgesScanned);
+    metric.counters["Scan Throughput (edges/s)"] = seconds > 0 ? result.edgesScanned / seconds : 0;
+    return matrix;
+}
+
+GraphAnalysisTool::DistanceMatrix GraphAnalysisTool::allPairsShortestPaths(AllPairsMethod method) {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    if (method == AllPairsMethod::AUTO || graph.minWeight() < 0) {
+        method = AllPairsShortestPaths::preferFloydWarshall(graph) ?
+            AllPairsMethod::FLOYD_WARSHALL : AllPairsMethod::REPEATED_DIJKSTRA;
+    }
+
+    const std::string operation = method == AllPairsMethod::FLOYD_WARSHALL ?
+        "All-Pairs Shortest Paths (Floyd-Warshall)" : "All-Pairs Shortest Paths (Repeated Dijkstra)";
+    Timer timer(operation, *this);
+
+    DistanceMatrix matrix;
+    matrix.rows = graph.numVertices();
+    matrix.columns = graph.numVertices();
+    if (method == AllPairsMethod::FLOYD_WARSHALL) {
+        AllPairsShortestPaths::Result result = AllPairsShortestPaths::floydWarshall(graph);
+        matrix.distances = std::move(result.distances);
+        matrix.negativeCycle = result.negativeCycle;
+    }
+    else {
+        matrix.distances = AllPairsShortestPaths::repeatedDijkstra(graph);
+    }
+
+    PerformanceMetrics& metric = metrics[operation];
+    metric.nodesProcessed = graph.numVertices();
+    metric.counters["Edge Density"] = AllPairsShortestPaths::density(graph);
+    metric.counters["Negative Cycle"] = matrix.negativeCycle ? 1 : 0;
+    return matrix;
 }
 
 std::string GraphAnalysisTool::findCommunitiesOutput() {
@@ -116,7 +673,7 @@ std::string GraphAnalysisTool::findCommunitiesOutput() {
     ss << "Communities found: " << communities.size() << "\n";
 
     // Track nodes in communities
-    std::set<int> nodesInCommunities;
+    std::set<NodeId> nodesInCommunities;
 
     // Output non-isolated communities
     int communityCount = 0;
@@ -147,11 +704,12 @@ std::string GraphAnalysisTool::findCommunitiesOutput() {
     // Find and output self-loops
     ss << "\nSelf-loop Nodes: [";
     bool first = true;
-    for (const auto& [node, edges] : adjacencyList) {
-        for (const auto& [dest, _] : edges) {
-            if (dest == node) {
+    auto frozen = freeze();
+    for (int node = 0; node < frozen->numVertices(); node++) {
+        for (auto e = frozen->edgeBegin(node), last = frozen->edgeEnd(node); e < last; ++e) {
+            if (frozen->target(e) == node) {
                 if (!first) ss << ", ";
-                ss << "Node " << node;
+                ss << "Node " << frozen->toExternal(node);
                 first = false;
                 break;
             }
@@ -162,32 +720,201 @@ std::string GraphAnalysisTool::findCommunitiesOutput() {
     return ss.str();
 }
 
-std::vector<std::vector<int>> GraphAnalysisTool::findCommunities() {
-    std::vector<std::vector<int>> communities;
-    std::set<int> visited;
-    metrics["Community Detection"].nodesProcessed = 0;
+void GraphAnalysisTool::buildReachabilityIndex() {
+    auto frozen = freeze();
+    Timer timer("Reachability Index Build", *this);
+    reachability = std::make_shared<const ReachabilityIndex>(*frozen);
 
-    // First, find connected components
-    for (const auto& node : nodes) {
-        if (visited.find(node) == visited.end() && !isNodeIsolated(node)) {
-            std::vector<int> component;
-            dfsUtil(node, visited, component);
-            if (!component.empty()) {
-                communities.push_back(component);
-            }
+    PerformanceMetrics& metric = metrics["Reachability Index Build"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Components"] = static_cast<double>(reachability->numComponents());
+    metric.counters["Condensation Edges"] = static_cast<double>(reachability->numCondensationEdges());
+    metric.counters["Index Memory (KB)"] = reachability->memoryFootprint() / 1024.0;
+}
+
+bool GraphAnalysisTool::reachable(NodeId from, NodeId to) {
+    if (!reachability) buildReachabilityIndex();
+    // Without a snapshot the index was kept across an insertion, so the
+    // graph is materialized and idMap is current
+    const int source = snapshot ? snapshot->toDense(from) : idMap.toDense(from);
+    const int target = snapshot ? snapshot->toDense(to) : idMap.toDense(to);
+    return reachability->reachable(source, target, reachabilityState);
+}
+
+void GraphAnalysisTool::trackConnectivity() {
+    materialize();
+    Timer timer("Connectivity Tracking", *this);
+    connectivity = UnionFind(idMap.size());
+    for (int v = 0; v < idMap.size(); v++) {
+        for (const auto& [target, weight] : adjacencyList[v]) {
+            connectivity.unite(v, target);
         }
     }
+    connectivityTracked = true;
+
+    PerformanceMetrics& metric = metrics["Connectivity Tracking"];
+    metric.nodesProcessed = idMap.size();
+    metric.counters["Components"] = static_cast<double>(connectivity.setCount());
+}
+
+bool GraphAnalysisTool::connected(NodeId u, NodeId v) {
+    if (!connectivityTracked) trackConnectivity();
+    int a = idMap.toDense(u);
+    int b = idMap.toDense(v);
+    return a >= 0 && b >= 0 && connectivity.connected(a, b);
+}
+
+int GraphAnalysisTool::componentCount() {
+    if (!connectivityTracked) trackConnectivity();
+    return connectivity.setCount();
+}
+
+int GraphAnalysisTool::componentSize(NodeId node) {
+    if (!connectivityTracked) trackConnectivity();
+    int index = idMap.toDense(node);
+    return index < 0 ? 0 : connectivity.setSize(index);
+}
+
+ConnectedComponents::Result GraphAnalysisTool::connectedComponents() {
+    auto frozen = freeze();
+    Timer timer("Connected Components", *this);
+    ConnectedComponents::Result result = ConnectedComponents::run(*frozen);
+
+    PerformanceMetrics& metric = metrics["Connected Components"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Components"] = static_cast<double>(result.count);
+    return result;
+}
+
+StronglyConnectedComponents::Result GraphAnalysisTool::stronglyConnectedComponents() {
+    auto frozen = freeze();
+    Timer timer("Strongly Connected Components", *this);
+    StronglyConnectedComponents::Result result = StronglyConnectedComponents::run(*frozen);
+
+    std::vector<int> sizes(result.count, 0);
+    for (int c : result.component) sizes[c]++;
+    PerformanceMetrics& metric = metrics["Strongly Connected Components"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters["Components"] = static_cast<double>(result.count);
+    metric.counters["Largest Component"] =
+        sizes.empty() ? 0 : static_cast<double>(*std::max_element(sizes.begin(), sizes.end()));
+    return result;
+}
+
+GraphAnalysisTool GraphAnalysisTool::condensation() {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    StronglyConnectedComponents::Result scc = stronglyConnectedComponents();
+    Timer timer("Condensation", *this);
+
+    // Lightest edge between each ordered pair of distinct components
+    std::vector<Edge> edges;
+    for (int v = 0; v < graph.numVertices(); v++) {
+        for (auto e = graph.edgeBegin(v), last = graph.edgeEnd(v); e < last; ++e) {
+            int from = scc.component[v];
+            int to = scc.component[graph.target(e)];
+            if (from != to) edges.push_back({ from, to, graph.weight(e) });
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+        return std::tie(a.from, a.to, a.weight) < std::tie(b.from, b.to, b.weight);
+    });
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+        return a.from == b.from && a.to == b.to;
+    }), edges.end());
+
+    GraphAnalysisTool dag;
+    for (int c = 0; c < scc.count; c++) {
+        dag.addNode(c);
+    }
+    dag.addEdges(edges);
+
+    PerformanceMetrics& metric = metrics["Condensation"];
+    metric.nodesProcessed = scc.count;
+    metric.counters["DAG Edges"] = static_cast<double>(edges.size());
+    return dag;
+}
+
+std::vector<std::vector<NodeId>> GraphAnalysisTool::findCommunities() {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    ConnectedComponents::Result components = connectedComponents();
+    metrics["Community Detection"].nodesProcessed = graph.numVertices();
+
+    // Bucket vertices by component; isolated vertices are listed afterwards
+    std::vector<size_t> sizes(components.count, 0);
+    for (int v = 0; v < graph.numVertices(); v++) {
+        if (graph.degree(v) > 0 || graph.inDegree(v) > 0) sizes[components.component[v]]++;
+    }
+    std::vector<std::vector<NodeId>> communities;
+    std::vector<int> slot(components.count, -1);
+    for (int v = 0; v < graph.numVertices(); v++) {
+        if (graph.degree(v) == 0 && graph.inDegree(v) == 0) continue;
+        int& index = slot[components.component[v]];
+        if (index < 0) {
+            index = static_cast<int>(communities.size());
+            communities.emplace_back();
+            communities.back().reserve(sizes[components.component[v]]);
+        }
+        communities[index].push_back(graph.toExternal(v));
+    }
 
     // Then, add isolated nodes as single-node communities
     auto isolated = getIsolatedNodes();
-    for (int node : isolated) {
+    for (NodeId node : isolated) {
         communities.push_back({ node });
     }
 
     return communities;
 }
 
-std::string GraphAnalysisTool::findMaxFlowOutput(int source, int sink) {
+Louvain::Result GraphAnalysisTool::louvainCommunities() {
+    auto frozen = freeze();
+    Timer timer("Louvain", *this);
+    Louvain::Result result = Louvain::run(*frozen);
+
+    PerformanceMetrics& metric = metrics["Louvain"];
+    metric.nodesProcessed = frozen->numVertices();
+    metric.counters.clear();
+    metric.counters["Levels"] = static_cast<double>(result.levels.size());
+    metric.counters["Communities"] = static_cast<double>(result.count);
+    metric.counters["Modularity"] = result.modularity;
+    for (size_t i = 0; i < result.levels.size(); i++) {
+        const std::string prefix = "Level " + std::to_string(i + 1) + " ";
+        metric.counters[prefix + "Time (s)"] = result.levels[i].seconds;
+        metric.counters[prefix + "Modularity"] = result.levels[i].modularity;
+        metric.counters[prefix + "Communities"] = static_cast<double>(result.levels[i].communities);
+    }
+    return result;
+}
+
+std::vector<int> GraphAnalysisTool::labelPropagationCommunities() {
+    refreshLabelPropagation();
+    return labelPropagation.labels();
+}
+
+int GraphAnalysisTool::labelPropagationCommunity(NodeId node) {
+    refreshLabelPropagation();
+    int index = idMap.toDense(node);
+    return index < 0 ? -1 : labelPropagation.getLabel(index);
+}
+
+void GraphAnalysisTool::refreshLabelPropagation() {
+    materialize();
+    if (labelPropagation.isInitialized() && labelPropagation.pendingCount() == 0) return;
+    Timer timer("Label Propagation", *this);
+    PerformanceMetrics& metric = metrics["Label Propagation"];
+    metric.counters["Touched Vertices"] = static_cast<double>(
+        labelPropagation.isInitialized() ? labelPropagation.pendingCount() : idMap.size());
+    if (!labelPropagation.isInitialized()) labelPropagation.reset(idMap.size());
+
+    LabelPropagation::Stats stats = labelPropagation.propagate(adjacencyList, reverseAdjacencyList);
+    metric.nodesProcessed = stats.evaluated;
+    metric.counters["Label Changes"] = static_cast<double>(stats.changed);
+    metric.counters["Rounds"] = static_cast<double>(stats.rounds);
+}
+
+std::string GraphAnalysisTool::findMaxFlowOutput(NodeId source, NodeId sink) {
     Timer timer("Maximum Flow", *this);
     std::stringstream ss;
 
@@ -208,23 +935,57 @@ std::string GraphAnalysisTool::findMaxFlowOutput(int source, int sink) {
     return ss.str();
 }
 
-std::pair<int, std::vector<std::pair<std::vector<int>, int>>>
-GraphAnalysisTool::maxFlow(int source, int sink) {
-    std::unordered_map<int, std::unordered_map<int, int>> residualGraph;
-    std::vector<std::pair<std::vector<int>, int>> flowPaths;
+std::pair<int, std::vector<std::pair<std::vector<NodeId>, int>>>
+GraphAnalysisTool::maxFlow(NodeId sourceNode, NodeId sinkNode) {
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
+    const int vertexCount = graph.numVertices();
+    int source = graph.toDense(sourceNode);
+    int sink = graph.toDense(sinkNode);
+    std::vector<std::pair<std::vector<NodeId>, int>> flowPaths;
+    if (source < 0 || sink < 0 || source == sink) {
+        return { 0, flowPaths };
+    }
+
+    // Residual graph in CSR form: every edge contributes a forward arc at its
+    // tail and a zero-capacity reverse arc at its head, linked through arcPair
+    const size_t edgeCount = graph.numEdges();
+    std::vector<size_t> arcOffsets(static_cast<size_t>(vertexCount) + 1, 0);
+    for (int u = 0; u < vertexCount; u++) {
+        arcOffsets[u + 1] += graph.degree(u);
+        for (auto e = graph.edgeBegin(u), last = graph.edgeEnd(u); e < last; ++e) {
+            arcOffsets[graph.target(e) + 1]++;
+        }
+    }
+    for (int u = 0; u < vertexCount; u++) {
+        arcOffsets[u + 1] += arcOffsets[u];
+    }
 
-    // Initialize residual graph
-    for (const auto& [node, edges] : adjacencyList) {
-        for (const auto& [dest, capacity] : edges) {
-            residualGraph[node][dest] = capacity;
+    std::vector<int> arcHead(2 * edgeCount);
+    std::vector<int> arcCapacity(2 * edgeCount);
+    std::vector<size_t> arcPair(2 * edgeCount);
+    std::vector<size_t> cursor(arcOffsets.begin(), arcOffsets.end() - 1);
+    for (int u = 0; u < vertexCount; u++) {
+        for (auto e = graph.edgeBegin(u), last = graph.edgeEnd(u); e < last; ++e) {
+            int v = graph.target(e);
+            size_t forward = cursor[u]++;
+            size_t backward = cursor[v]++;
+            arcHead[forward] = v;
+            arcCapacity[forward] = graph.weight(e);
+            arcPair[forward] = backward;
+            arcHead[backward] = u;
+            arcCapacity[backward] = 0;
+            arcPair[backward] = forward;
         }
     }
 
     int maxFlowValue = 0;
     metrics["Maximum Flow"].nodesProcessed = 0;
 
+    std::vector<int> parent(vertexCount);
+    std::vector<size_t> parentArc(vertexCount);
     while (true) {
-        std::vector<int> parent(numNodes, -1);
+        std::fill(parent.begin(), parent.end(), -1);
         std::queue<int> q;
         q.push(source);
         parent[source] = source;
@@ -234,9 +995,11 @@ GraphAnalysisTool::maxFlow(int source, int sink) {
             q.pop();
             metrics["Maximum Flow"].nodesProcessed++;
 
-            for (const auto& [next, capacity] : residualGraph[current]) {
-                if (parent[next] == -1 && capacity > 0) {
+            for (size_t arc = arcOffsets[current]; arc < arcOffsets[current + 1]; arc++) {
+                int next = arcHead[arc];
+                if (parent[next] == -1 && arcCapacity[arc] > 0) {
                     parent[next] = current;
+                    parentArc[next] = arc;
                     q.push(next);
                 }
             }
@@ -248,32 +1011,34 @@ GraphAnalysisTool::maxFlow(int source, int sink) {
         std::vector<int> path;
         for (int v = sink; v != source; v = parent[v]) {
             path.push_back(v);
-            pathFlow = std::min(pathFlow, residualGraph[parent[v]][v]);
+            pathFlow = std::min(pathFlow, arcCapacity[parentArc[v]]);
         }
         path.push_back(source);
         std::reverse(path.begin(), path.end());
 
         for (int v = sink; v != source; v = parent[v]) {
-            int u = parent[v];
-            residualGraph[u][v] -= pathFlow;
-            residualGraph[v][u] += pathFlow;
+            arcCapacity[parentArc[v]] -= pathFlow;
+            arcCapacity[arcPair[parentArc[v]]] += pathFlow;
         }
 
         maxFlowValue += pathFlow;
-        flowPaths.push_back({ path, pathFlow });
+        flowPaths.push_back({ toExternalPath(graph, path), pathFlow });
     }
 
     return { maxFlowValue, flowPaths };
 }
 
-std::vector<std::tuple<int, int, int>> GraphAnalysisTool::findMST() {
+std::vector<std::tuple<NodeId, NodeId, int>> GraphAnalysisTool::findMST() {
     Timer timer("Minimum Spanning Tree", *this);
+    auto frozen = freeze();
+    const CSRGraph& graph = *frozen;
     std::vector<std::tuple<int, int, int>> edges;
+    edges.reserve(graph.numEdges());
 
     // Collect all edges
-    for (const auto& [from, neighbors] : adjacencyList) {
-        for (const auto& [to, weight] : neighbors) {
-            edges.emplace_back(from, to, weight);
+    for (int from = 0; from < graph.numVertices(); from++) {
+        for (auto e = graph.edgeBegin(from), last = graph.edgeEnd(from); e < last; ++e) {
+            edges.emplace_back(from, graph.target(e), graph.weight(e));
         }
     }
 
@@ -283,13 +1048,13 @@ std::vector<std::tuple<int, int, int>> GraphAnalysisTool::findMST() {
             return std::get<2>(a) < std::get<2>(b);
         });
 
-    UnionFind uf(numNodes);
-    std::vector<std::tuple<int, int, int>> mst;
+    UnionFind uf(graph.numVertices());
+    std::vector<std::tuple<NodeId, NodeId, int>> mst;
 
     for (const auto& [from, to, weight] : edges) {
         if (uf.find(from) != uf.find(to)) {
             uf.unite(from, to);
-            mst.emplace_back(from, to, weight);
+            mst.emplace_back(graph.toExternal(from), graph.toExternal(to), weight);
             metrics["Minimum Spanning Tree"].nodesProcessed++;
         }
     }
@@ -324,11 +1089,14 @@ std::string GraphAnalysisTool::getPerformanceMetrics() const {
             << "  Nodes Processed: " << metric.nodesProcessed << "\n"
             << "  Memory Used: " << std::fixed << std::setprecision(2)
             << (metric.memoryUsed / 1024.0) << " KB\n";
+        for (const auto& [name, value] : metric.counters) {
+            ss << "  " << name << ": " << std::fixed << std::setprecision(2) << value << "\n";
+        }
     }
     return ss.str();
 }
 
-std::string GraphAnalysisTool::generateFullAnalysis(int startNode, int endNode) {
+std::string GraphAnalysisTool::generateFullAnalysis(NodeId startNode, NodeId endNode) {
     std::stringstream ss;
     ss << "--- Graph Analysis Summary ---\n\n";
 
@@ -360,9 +1128,11 @@ void GraphAnalysisTool::exportToDOT(const std::string& filename) {
     std::ofstream out(filename);
     out << "digraph G {\n";
 
-    for (const auto& [node, edges] : adjacencyList) {
-        for (const auto& [dest, weight] : edges) {
-            out << "    " << node << " -> " << dest
+    auto frozen = freeze();
+    for (int node = 0; node < frozen->numVertices(); node++) {
+        for (auto e = frozen->edgeBegin(node), last = frozen->edgeEnd(node); e < last; ++e) {
+            int weight = frozen->weight(e);
+            out << "    " << frozen->toExternal(node) << " -> " << frozen->toExternal(frozen->target(e))
                 << " [label=\"" << weight << "\"];\n";
         }
     }
@@ -371,37 +1141,46 @@ void GraphAnalysisTool::exportToDOT(const std::string& filename) {
     out.close();
 }
 
-void GraphAnalysisTool::addNode(int node) {
-    nodes.insert(node);
-    numNodes = std::max(numNodes, node + 1);
+void GraphAnalysisTool::addNode(NodeId node) {
+    materialize();
     // Ensure node exists in adjacency list even if it has no edges
-    if (adjacencyList.find(node) == adjacencyList.end()) {
-        adjacencyList[node] = std::vector<std::pair<int, int>>();
+    int index = idMap.insert(node);
+    if (index == static_cast<int>(adjacencyList.size())) {
+        adjacencyList.emplace_back();
+        reverseAdjacencyList.emplace_back();
+        invalidateSnapshot();
+        if (labelPropagation.isInitialized()) labelPropagation.touch(index);
+        if (connectivityTracked) connectivity.grow(idMap.size());
     }
 }
 
 
-std::vector<int> GraphAnalysisTool::getIsolatedNodes() const {
-    std::vector<int> isolated;
-    for (int node : nodes) {
-        if (isNodeIsolated(node)) {
-            isolated.push_back(node);
+std::vector<NodeId> GraphAnalysisTool::getIsolatedNodes() const {
+    std::vector<NodeId> isolated;
+    if (!materialized) {
+        for (int v = 0; v < snapshot->numVertices(); v++) {
+            if (snapshot->degree(v) == 0 && snapshot->inDegree(v) == 0) {
+                isolated.push_back(snapshot->toExternal(v));
+            }
+        }
+        return isolated;
+    }
+
+    for (int v = 0; v < idMap.size(); v++) {
+        if (adjacencyList[v].empty() && reverseAdjacencyList[v].empty()) {
+            isolated.push_back(idMap.toExternal(v));
         }
     }
     return isolated;
 }
 
-bool GraphAnalysisTool::isNodeIsolated(int node) const {
+bool GraphAnalysisTool::isNodeIsolated(NodeId node) const {
     // Check if node has any incoming or outgoing edges
-    if (adjacencyList.find(node) == adjacencyList.end() ||
-        adjacencyList.at(node).empty()) {
-        // Check for incoming edges
-        for (const auto& [src, edges] : adjacencyList) {
-            for (const auto& [dest, _] : edges) {
-                if (dest == node) return false;
-            }
-        }
-        return true;
+    if (!materialized) {
+        int index = snapshot->toDense(node);
+        return index < 0 || (snapshot->degree(index) == 0 && snapshot->inDegree(index) == 0);
     }
-    return false;
+    int index = idMap.toDense(node);
+    return index < 0 ||
+        (adjacencyList[index].empty() && reverseAdjacencyList[index].empty());
 }
\ No newline at end of file
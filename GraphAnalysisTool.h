@@ -8,67 +8,293 @@
 #include <unordered_set>
 #include <string>
 #include <tuple>
+#include <memory>
+#include "BreadthFirstSearch.h"
+#include "CSRGraph.h"
+#include "ConnectedComponents.h"
+#include "ContractionHierarchy.h"
+#include "DijkstraWorkspace.h"
+#include "DynamicShortestPaths.h"
+#include "LabelPropagation.h"
+#include "LandmarkIndex.h"
+#include "Louvain.h"
 #include "PerformanceMetrics.h"
+#include "ReachabilityIndex.h"
+#include "ShortestPathCache.h"
+#include "StronglyConnectedComponents.h"
 #include "Timer.h"
 #include "UnionFind.h"
+#include "VertexIdMap.h"
 
 class GraphAnalysisTool {
 private:
-    std::unordered_map<int, std::vector<std::pair<int, int>>> adjacencyList;
-    std::unordered_set<int> nodes;
-    int numNodes;
+    // Vertices are stored under dense indices assigned by idMap; adjacency
+    // entries hold (dense target, weight) pairs and reverse adjacency entries
+    // the matching (dense source, weight) pairs. A graph opened from a binary
+    // file starts with only its snapshot; these are then built on first use.
+    mutable VertexIdMap idMap;
+    mutable std::vector<std::vector<std::pair<int, int>>> adjacencyList;
+    mutable std::vector<std::vector<std::pair<int, int>>> reverseAdjacencyList;
+    mutable bool materialized;
     int numEdges;
     std::unordered_map<std::string, PerformanceMetrics> metrics;
+    std::shared_ptr<const CSRGraph> snapshot;
+    DijkstraWorkspace pathWorkspace;
+    DijkstraWorkspace reversePathWorkspace;
+    // Built by preprocessLandmarks for the current snapshot
+    std::shared_ptr<const LandmarkIndex> landmarks;
+    // Built by buildContractionHierarchy or loadContractionHierarchy
+    std::shared_ptr<const ContractionHierarchy> hierarchy;
+    // Incremented by every mutation; tags cached results
+    std::uint64_t version;
+    ShortestPathCache pathCache;
+    // Trees for tracked sources, updated in place by every insertion
+    std::vector<DynamicShortestPaths> trackedSources;
+    // Built lazily by reachable(); kept across insertions that do not change
+    // reachability, rebuilt after any other mutation
+    std::shared_ptr<const ReachabilityIndex> reachability;
+    ReachabilityIndex::SearchState reachabilityState;
+    // Streaming label propagation; once started, insertions touch endpoints
+    LabelPropagation labelPropagation;
+    // Weak connectivity over dense vertices, maintained by every insertion
+    // once trackConnectivity has run
+    UnionFind connectivity;
+    bool connectivityTracked;
 
-    void dfsUtil(int node, std::set<int>& visited, std::vector<int>& component);
+    void materialize() const;
+    // Drops the snapshot and every index derived from it after a mutation
+    void invalidateSnapshot();
+    const DynamicShortestPaths* findTracked(int source) const;
+    // Stops tracking every source once a negative weight appears
+    void dropTrackedSources();
+    // Starts label propagation or continues it from the touched vertices
+    void refreshLabelPropagation();
+    static std::vector<NodeId> toExternalPath(const CSRGraph& graph, const std::vector<int>& path);
 
 public:
+    struct Edge {
+        NodeId from;
+        NodeId to;
+        int weight = 1;
+    };
+
     GraphAnalysisTool();
+    // Read-only view over an existing snapshot; mutable state is built lazily
+    explicit GraphAnalysisTool(std::shared_ptr<const CSRGraph> frozen);
 
     // Graph structure operations
-    void addEdge(int from, int to, int weight = 1);
+    void addEdge(NodeId from, NodeId to, int weight = 1);
+    // Bulk insertion: sizes every adjacency row exactly once and fills rows
+    // in parallel. Equivalent to calling addEdge for each edge in order.
+    void addEdges(const Edge* edges, size_t count);
+    void addEdges(const std::vector<Edge>& edges);
+    // Lowers the weight of the first from -> to edge heavier than weight.
+    // Returns false if there is no such edge.
+    bool decreaseEdgeWeight(NodeId from, NodeId to, int weight);
     std::string printGraphStructure() const;
 
+    // Immutable CSR view used by the read-only algorithms. Rebuilt lazily after
+    // the graph is mutated; previously returned snapshots remain valid.
+    std::shared_ptr<const CSRGraph> freeze();
+
+    // Binary snapshot persistence (see BinaryGraphFormat). loadBinary maps the
+    // file and answers queries from it directly without copying the arrays.
+    void saveBinary(const std::string& filename);
+    static GraphAnalysisTool loadBinary(const std::string& filename);
+
+    // Unweighted traversal: direction-optimizing parallel BFS from source.
+    // Vectors are in getNodes() order and parents are positions in it.
+    BreadthFirstSearch::Result breadthFirstSearch(NodeId source);
+    // Hop distances in getNodes() order, -1 if unreachable
+    std::vector<int> hopDistances(NodeId source);
+
     // Path finding operations
-    std::string findShortestPath(int start, int end);
-    std::pair<std::vector<int>, int> shortestPath(int start, int end);
+    enum class PathAlgorithm {
+        DIJKSTRA,       // Unidirectional Dijkstra with early termination
+        BIDIRECTIONAL,  // Forward and backward Dijkstra meeting in the middle
+        ALT,            // A* with landmark lower bounds (see preprocessLandmarks)
+        CONTRACTION_HIERARCHY // Upward search in the contraction hierarchy
+    };
+
+    // One-time ALT preprocessing for repeated point-to-point queries on the
+    // current snapshot. ALT queries run it with the default landmark count if
+    // it has not been done; any mutation discards the index.
+    void preprocessLandmarks(int landmarkCount = LandmarkIndex::DEFAULT_LANDMARKS);
+
+    // Contraction hierarchy for the current snapshot, built on first use and
+    // discarded by any mutation. The query object stays valid independently.
+    void buildContractionHierarchy();
+    HierarchyQuery createHierarchyQuery();
+    void saveContractionHierarchy(const std::string& filename);
+    // Attaches a hierarchy saved for this same snapshot
+    void loadContractionHierarchy(const std::string& filename);
+
+    std::string findShortestPath(NodeId start, NodeId end,
+        PathAlgorithm algorithm = PathAlgorithm::DIJKSTRA);
+    // Path and distance, or an empty path and INT_MAX if end is unreachable.
+    // DIJKSTRA handles negative weights with a Bellman-Ford search; if a
+    // negative cycle reachable from start also reaches end, there is no
+    // shortest path and the result is an empty path and INT_MIN. On graphs
+    // with a negative weight, BIDIRECTIONAL, ALT and CONTRACTION_HIERARCHY
+    // queries take that same search.
+    std::pair<std::vector<NodeId>, int> shortestPath(NodeId start, NodeId end);
+    std::pair<std::vector<NodeId>, int> shortestPath(NodeId start, NodeId end, PathAlgorithm algorithm);
+    // Up to k loopless paths from start to end in non-decreasing weight order
+    // (Yen's algorithm); spur searches and tree reuse are reported under
+    // "K Shortest Paths"
+    std::vector<std::pair<std::vector<NodeId>, int>> kShortestPaths(NodeId start, NodeId end, size_t k);
+
+    // Optional LRU cache of up to maxTrees shortest path trees keyed by source.
+    // While enabled, DIJKSTRA queries compute the source's full tree once and
+    // answer later queries from it; hits and misses are reported under
+    // "Shortest Path". Mutations invalidate the cache. 0 disables it.
+    void enablePathCache(size_t maxTrees);
+
+    // Keeps a shortest path tree for source that addEdge, addEdges and
+    // decreaseEdgeWeight update incrementally, touching only the vertices
+    // whose distance improves. DIJKSTRA queries from a tracked source are
+    // answered from its tree. Update work is reported under "Dynamic SSSP".
+    // The updates need non-negative weights: trackSource does nothing while
+    // the graph has a negative weight, and adding one stops tracking every
+    // source (counted as "Dropped Trees"), so later queries search afresh.
+    void trackSource(NodeId source);
+    void untrackSource(NodeId source);
+
+    // Distances from source to every vertex, in getNodes() order (INT_MAX if
+    // unreachable), computed with parallel delta-stepping. delta <= 0 picks
+    // the bucket width automatically. Delta-stepping needs non-negative
+    // weights, so the result is empty if the graph has a negative one.
+    std::vector<int> shortestDistances(NodeId source, int delta = 0);
+
+    // Row-major sources x targets distances, INT_MAX where unreachable or
+    // where an ID is not in the graph (hop distances use -1 instead)
+    struct DistanceMatrix {
+        size_t rows = 0;
+        size_t columns = 0;
+        std::vector<int> distances;
+        // Only set by allPairsShortestPaths; distances are unreliable when true
+        bool negativeCycle = false;
+
+        int at(size_t row, size_t column) const { return distances[row * columns + column]; }
+    };
+
+    // Many-to-many distances. One search per source runs on the worker pool
+    // with a reused workspace per thread, and each search stops as soon as
+    // every target is settled.
+    DistanceMatrix distanceMatrix(const std::vector<NodeId>& sources, const std::vector<NodeId>& targets);
+
+    // Hop distances from many sources at once with bit-parallel multi-source
+    // BFS; columns follow getNodes() order. Edges scanned and throughput are
+    // recorded under "Multi-Source BFS". Unreachable vertices, and every
+    // column of a source not in the graph, are -1 as in hopDistances.
+    DistanceMatrix multiSourceHopDistances(const std::vector<NodeId>& sources);
+
+    enum class AllPairsMethod {
+        AUTO,               // Chosen by edge density
+        FLOYD_WARSHALL,     // Cache-blocked, for dense graphs
+        REPEATED_DIJKSTRA   // One parallel search per source, for sparse graphs
+                            // with non-negative weights
+    };
+
+    // Square matrix of all distances with rows and columns in getNodes()
+    // order. Needs getNumNodes()^2 ints of memory. Graphs with negative
+    // weights always use Floyd-Warshall, which flags negative cycles.
+    DistanceMatrix allPairsShortestPaths(AllPairsMethod method = AllPairsMethod::AUTO);
+
+    // Builds the reachability index for the current graph; reachable() calls
+    // this on demand
+    void buildReachabilityIndex();
+    // Whether a directed path leads from one node to the other
+    bool reachable(NodeId from, NodeId to);
+
+    // Keeps weakly connected components current through addNode, addEdge
+    // and addEdges, so the queries below cost O(alpha(n)) instead of a
+    // traversal. They start tracking on first use.
+    void trackConnectivity();
+    bool connected(NodeId u, NodeId v);
+    int componentCount();
+    // Nodes in node's weakly connected component, 0 if it is not in the graph
+    int componentSize(NodeId node);
+
+    // Weakly connected components: a component ID for every vertex in
+    // getNodes() order. Large graphs are labeled in parallel (Afforest).
+    ConnectedComponents::Result connectedComponents();
+
+    // Strongly connected components, a component ID for every vertex in
+    // getNodes() order; large graphs are decomposed in parallel
+    StronglyConnectedComponents::Result stronglyConnectedComponents();
+    // Condensation DAG: node i is strongly connected component i, with one
+    // edge per connected pair of components carrying the lightest weight
+    // between them
+    GraphAnalysisTool condensation();
 
     // Community detection
     std::string findCommunitiesOutput();
-    std::vector<std::vector<int>> findCommunities();
+    // Weakly connected components with edges, then isolated nodes as
+    // single-node communities
+    std::vector<std::vector<NodeId>> findCommunities();
+    // Modularity-based communities (parallel multi-level Louvain) for every
+    // node in getNodes() order. Time, modularity and community count of
+    // each level are recorded under "Louvain".
+    Louvain::Result louvainCommunities();
+    // Label propagation communities for every node in getNodes() order. The
+    // first call labels the whole graph; later calls only re-propagate from
+    // endpoints of edges added or lowered since, so a refresh after a batch
+    // of insertions is cheap. Work is reported under "Label Propagation".
+    std::vector<int> labelPropagationCommunities();
+    // Community label of one node after the same incremental refresh; -1 if
+    // the node is not in the graph
+    int labelPropagationCommunity(NodeId node);
 
     // Maximum flow
-    std::string findMaxFlowOutput(int source, int sink);
-    std::pair<int, std::vector<std::pair<std::vector<int>, int>>> maxFlow(int source, int sink);
+    std::string findMaxFlowOutput(NodeId source, NodeId sink);
+    std::pair<int, std::vector<std::pair<std::vector<NodeId>, int>>> maxFlow(NodeId source, NodeId sink);
 
     // Minimum spanning tree
-    std::vector<std::tuple<int, int, int>> findMST();
+    std::vector<std::tuple<NodeId, NodeId, int>> findMST();
     std::string getMSTOutput();
 
     // Performance and output
     std::string getPerformanceMetrics() const;
-    std::string generateFullAnalysis(int startNode, int endNode);
+    std::string generateFullAnalysis(NodeId startNode, NodeId endNode);
     void exportToDOT(const std::string& filename);
 
     friend class Timer;
+    friend class EdgeListLoader;
 
-    void addNode(int node);
-    std::vector<int> getIsolatedNodes() const;
-    bool isNodeIsolated(int node) const;
+    void addNode(NodeId node);
+    std::vector<NodeId> getIsolatedNodes() const;
+    bool isNodeIsolated(NodeId node) const;
 
-    const std::unordered_map<int, std::vector<std::pair<int, int>>>& getAdjacencyList() const {
+    // Adjacency indexed by dense vertex index; use getNodes() to translate
+    // indices back to external node IDs
+    const std::vector<std::vector<std::pair<int, int>>>& getAdjacencyList() const {
+        materialize();
         return adjacencyList;
     }
 
-    const std::unordered_set<int>& getNodes() const {
-        return nodes;
+    // Incoming edges indexed by dense vertex index, kept in sync by addEdge
+    const std::vector<std::vector<std::pair<int, int>>>& getReverseAdjacencyList() const {
+        materialize();
+        return reverseAdjacencyList;
+    }
+
+    // External node IDs in dense index order
+    const std::vector<NodeId>& getNodes() const {
+        materialize();
+        return idMap.getExternalIds();
+    }
+
+    const VertexIdMap& getIdMap() const {
+        materialize();
+        return idMap;
     }
 
     int getNumNodes() const {
-        return numNodes;
+        return materialized ? idMap.size() : snapshot->numVertices();
     }
 
     int getNumEdges() const {
         return numEdges;
     }
-};
\ No newline at end of file
+};
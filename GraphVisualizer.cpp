@@ -29,6 +29,19 @@ std::string GraphVisualizer::colorForWeight(double weight, double maxWeight) {
     return ss.str();
 }
 
+std::string GraphVisualizer::nodeFillColor(const VisualizationOptions& options, size_t index) {
+    // Categorical palette, cycled when there are more communities
+    static const char* const palette[] = {
+        "#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd",
+        "#8c564b", "#e377c2", "#7f7f7f", "#bcbd22", "#17becf"
+    };
+    if (options.colorScheme == ColorScheme::COMMUNITY && index < options.communities.size() &&
+        options.communities[index] >= 0) {
+        return palette[options.communities[index] % 10];
+    }
+    return options.nodeColor;
+}
+
 void GraphVisualizer::exportToDOT(const GraphAnalysisTool& graph,
     const std::string& filename,
     const VisualizationOptions& options) {
@@ -71,29 +84,41 @@ void GraphVisualizer::exportToDOT(const GraphAnalysisTool& graph,
     double maxWeight = 0;
 
     // First, declare all nodes (including isolated ones)
-    for (int node : nodes) {
-        out << "    " << node;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        out << "    " << nodes[i];
+        std::vector<std::string> attrs;
         if (options.showLabels) {
-            out << " [label=\"" << node << "\"]";
+            attrs.push_back("label=\"" + std::to_string(nodes[i]) + "\"");
+        }
+        if (options.colorScheme == ColorScheme::COMMUNITY && !options.communities.empty()) {
+            attrs.push_back("fillcolor=\"" + nodeFillColor(options, i) + "\"");
+        }
+        if (!attrs.empty()) {
+            out << " [";
+            for (size_t a = 0; a < attrs.size(); ++a) {
+                if (a > 0) out << ", ";
+                out << attrs[a];
+            }
+            out << "]";
         }
         out << ";\n";
     }
 
     // Find max weight for color scaling
     if (options.colorScheme == ColorScheme::WEIGHT) {
-        for (const auto& [_, edges] : adjacencyList) {
-            for (const auto& [__, weight] : edges) {
+        for (const auto& edges : adjacencyList) {
+            for (const auto& [_, weight] : edges) {
                 maxWeight = std::max(maxWeight, static_cast<double>(weight));
             }
         }
     }
 
     // Add edges
-    for (const auto& [from, edges] : adjacencyList) {
-        for (const auto& [to, weight] : edges) {
-            out << "    " << from << " "
+    for (size_t from = 0; from < adjacencyList.size(); ++from) {
+        for (const auto& [to, weight] : adjacencyList[from]) {
+            out << "    " << nodes[from] << " "
                 << (options.directed ? "->" : "--") << " "
-                << to;
+                << nodes[to];
 
             // Edge attributes
             std::vector<std::string> attrs;
@@ -173,22 +198,20 @@ void GraphVisualizer::exportToHTML(const GraphAnalysisTool& graph,
     out << "    nodes: [\n";
 
     const auto& nodes = graph.getNodes();
-    bool firstNode = true;
-    for (int node : nodes) {
-        if (!firstNode) out << ",\n";
-        out << "        { id: " << node << " }";
-        firstNode = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (i > 0) out << ",\n";
+        out << "        { id: " << nodes[i] << ", color: '" << nodeFillColor(options, i) << "' }";
     }
 
     out << "\n    ],\n    links: [\n";
 
     const auto& adjacencyList = graph.getAdjacencyList();
     bool firstEdge = true;
-    for (const auto& [from, edges] : adjacencyList) {
-        for (const auto& [to, weight] : edges) {
+    for (size_t from = 0; from < adjacencyList.size(); ++from) {
+        for (const auto& [to, weight] : adjacencyList[from]) {
             if (!firstEdge) out << ",\n";
-            out << "        { source: " << from
-                << ", target: " << to
+            out << "        { source: " << nodes[from]
+                << ", target: " << nodes[to]
                 << ", weight: " << weight << " }";
             firstEdge = false;
         }
@@ -360,7 +383,7 @@ void GraphVisualizer::exportToHTML(const GraphAnalysisTool& graph,
             .join('circle')
             .attr('class', 'node')
             .attr('r', )" << options.nodeSize << R"()
-            .style('fill', ')" << options.nodeColor << R"(');
+            .style('fill', d => d.color);
 
         // Add node labels if enabled
         let labels = null;
@@ -516,7 +539,7 @@ void GraphVisualizer::exportToHTML(const GraphAnalysisTool& graph,
         .attr('r', )" << options.nodeSize << R"()
         .attr('cx', d => d.x)
         .attr('cy', d => d.y)
-        .style('fill', ')" << options.nodeColor << R"(');
+        .style('fill', d => d.color);
 
     // Add node labels
     if ()" << (options.showLabels ? "true" : "false") << R"() {
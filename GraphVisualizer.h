@@ -37,6 +37,9 @@ public:
         std::string nodeColor = "#1f77b4";
         std::string edgeColor = "#666666";
         std::string labelColor = "#000000";
+        // Community of each node in getNodes() order, e.g. from
+        // louvainCommunities(); COMMUNITY colors nodes by it
+        std::vector<int> communities;
     };
 
     static void exportToDOT(const GraphAnalysisTool& graph,
@@ -50,5 +53,7 @@ public:
 private:
     static std::string generateDOTAttributes(const VisualizationOptions& options);
     static std::string colorForWeight(double weight, double maxWeight);
+    // Fill color for node index under the options' color scheme
+    static std::string nodeFillColor(const VisualizationOptions& options, size_t index);
     static std::string getLayoutEngine(Layout layout);
 };
\ No newline at end of file
@@ -0,0 +1,113 @@
+// File: src/KShortestPaths.cpp
+#include "KShortestPaths.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace {
+    const int INF = DijkstraWorkspace::INF;
+
+    // Lightest edge from -> to; path distances are sums of these
+    int edgeWeight(const CSRGraph& graph, int from, int to) {
+        int best = INF;
+        for (auto e = graph.edgeBegin(from), last = graph.edgeEnd(from); e < last; ++e) {
+            if (graph.target(e) == to) best = std::min(best, graph.weight(e));
+        }
+        return best;
+    }
+}
+
+std::vector<KShortestPaths::Path> KShortestPaths::find(const CSRGraph& graph, int source, int target,
+    size_t k, DijkstraWorkspace& spurWorkspace, DijkstraWorkspace& treeWorkspace, Stats& stats) {
+    std::vector<Path> accepted;
+    if (k == 0 || source < 0 || target < 0) return accepted;
+
+    // Backward labels: distance to target and the next hop towards it
+    DijkstraWorkspace& tree = treeWorkspace;
+    tree.run(graph, target, -1, DijkstraWorkspace::Direction::BACKWARD);
+    if (tree.getDistance(source) == INF) return accepted;
+
+    auto treePath = [&](int from) {
+        std::vector<int> path;
+        for (int v = from; v != -1; v = tree.getParent(v)) {
+            path.push_back(v);
+        }
+        return path;
+    };
+
+    // Candidates ordered by (distance, vertices), which also removes
+    // duplicates; the value is the index where the candidate deviates
+    std::map<std::pair<int, std::vector<int>>, size_t> candidates;
+    candidates.emplace(std::make_pair(tree.getDistance(source), treePath(source)), 0);
+
+    std::vector<char> blocked(graph.numVertices(), 0);
+    std::vector<int> blockedNext;
+    std::vector<int> prefix;
+
+    while (!candidates.empty() && accepted.size() < k) {
+        auto best = candidates.begin();
+        accepted.push_back({ best->first.second, best->first.first });
+        const size_t deviation = best->second;
+        candidates.erase(best);
+        if (accepted.size() == k) break;
+
+        const std::vector<int>& path = accepted.back().vertices;
+        prefix.assign(1, 0);
+        for (size_t i = 0; i + 1 < path.size(); i++) {
+            prefix.push_back(prefix.back() + edgeWeight(graph, path[i], path[i + 1]));
+        }
+
+        // The root path[0..i) is removed so spur paths stay loopless
+        for (size_t i = 0; i < deviation; i++) {
+            blocked[path[i]] = 1;
+        }
+        for (size_t i = deviation; i + 1 < path.size(); i++) {
+            const int spur = path[i];
+
+            // Edges out of spur already used by accepted paths sharing the root
+            blockedNext.clear();
+            for (const Path& other : accepted) {
+                if (other.vertices.size() > i + 1 &&
+                    std::equal(path.begin(), path.begin() + i + 1, other.vertices.begin())) {
+                    blockedNext.push_back(other.vertices[i + 1]);
+                }
+            }
+            auto isBlockedNext = [&](int vertex) {
+                return std::find(blockedNext.begin(), blockedNext.end(), vertex) != blockedNext.end();
+            };
+
+            std::vector<int> spurPath;
+            int spurDistance = INF;
+            const int hop = tree.getParent(spur);
+            bool treeUsable = hop != -1 && !isBlockedNext(hop);
+            for (int v = hop; treeUsable && v != -1; v = tree.getParent(v)) {
+                treeUsable = !blocked[v];
+            }
+
+            if (treeUsable) {
+                stats.treeSpurs++;
+                spurPath = treePath(spur);
+                spurDistance = tree.getDistance(spur);
+            }
+            else {
+                stats.spurSearches++;
+                spurDistance = spurWorkspace.runAStar(graph, spur, target,
+                    [&](int v) { return blocked[v] ? INF : tree.getDistance(v); },
+                    [&](int from, int to) { return from != spur || !isBlockedNext(to); });
+                if (spurDistance != INF) spurPath = spurWorkspace.extractPath(target);
+            }
+
+            if (spurDistance != INF) {
+                std::vector<int> vertices(path.begin(), path.begin() + i);
+                vertices.insert(vertices.end(), spurPath.begin(), spurPath.end());
+                candidates.emplace(std::make_pair(prefix[i] + spurDistance, std::move(vertices)), i);
+            }
+            blocked[spur] = 1;
+        }
+        for (int v : path) {
+            blocked[v] = 0;
+        }
+    }
+
+    return accepted;
+}
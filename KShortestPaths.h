@@ -0,0 +1,35 @@
+// File: include/KShortestPaths.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+#include "DijkstraWorkspace.h"
+
+// Yen's k shortest loopless paths. One backward Dijkstra from the target
+// gives the exact distance from every vertex to the target, which serves
+// both as the first path and as an A* potential for every spur search: it
+// stays a consistent lower bound when vertices and edges are removed, and
+// vertices that cannot reach the target are pruned outright. When the
+// tree's own path from a spur vertex avoids everything removed for that
+// deviation it is taken directly and no search runs at all. Spur vertices
+// before a path's deviation point are skipped, as their deviations were
+// already generated from the path it branched off.
+class KShortestPaths {
+public:
+    struct Path {
+        std::vector<int> vertices;  // Dense vertex IDs, source first
+        int distance = 0;
+    };
+
+    struct Stats {
+        size_t spurSearches = 0;    // A* searches run
+        size_t treeSpurs = 0;       // Spur paths taken from the reverse tree
+    };
+
+    // Up to k paths in non-decreasing distance order; assumes non-negative
+    // weights. treeWorkspace holds the reverse tree, spurWorkspace the spur
+    // searches, so both are reused across all deviations.
+    static std::vector<Path> find(const CSRGraph& graph, int source, int target, size_t k,
+        DijkstraWorkspace& spurWorkspace, DijkstraWorkspace& treeWorkspace, Stats& stats);
+};
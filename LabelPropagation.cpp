@@ -0,0 +1,138 @@
+// File: src/LabelPropagation.cpp
+#include "LabelPropagation.h"
+#include <algorithm>
+#include "ParallelExecutor.h"
+
+namespace {
+    const size_t GRAIN = 256;
+}
+
+LabelPropagation::LabelPropagation() : vertexCount(0), capacity(0), initialized(false) {}
+
+LabelPropagation::LabelPropagation(const LabelPropagation& other)
+    : vertexCount(0), capacity(0), pending(other.pending), initialized(other.initialized) {
+    grow(other.vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) {
+        label[v].store(other.label[v].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        queued[v].store(other.queued[v].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+LabelPropagation& LabelPropagation::operator=(const LabelPropagation& other) {
+    if (this != &other) {
+        LabelPropagation copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+void LabelPropagation::grow(size_t count) {
+    if (count <= vertexCount) return;
+    if (count > capacity) {
+        size_t newCapacity = std::max(count, capacity * 2);
+        std::unique_ptr<std::atomic<int>[]> newLabel(new std::atomic<int>[newCapacity]);
+        std::unique_ptr<std::atomic<bool>[]> newQueued(new std::atomic<bool>[newCapacity]);
+        for (size_t v = 0; v < vertexCount; v++) {
+            newLabel[v].store(label[v].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            newQueued[v].store(queued[v].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        label = std::move(newLabel);
+        queued = std::move(newQueued);
+        capacity = newCapacity;
+    }
+    for (size_t v = vertexCount; v < count; v++) {
+        label[v].store(static_cast<int>(v), std::memory_order_relaxed);
+        queued[v].store(false, std::memory_order_relaxed);
+    }
+    vertexCount = count;
+}
+
+void LabelPropagation::reset(size_t count) {
+    vertexCount = 0;
+    grow(count);
+    pending.resize(count);
+    for (size_t v = 0; v < count; v++) {
+        pending[v] = static_cast<int>(v);
+        queued[v].store(true, std::memory_order_relaxed);
+    }
+    initialized = true;
+}
+
+void LabelPropagation::touch(int vertex) {
+    grow(static_cast<size_t>(vertex) + 1);
+    if (!queued[vertex].exchange(true, std::memory_order_relaxed)) pending.push_back(vertex);
+}
+
+LabelPropagation::Stats LabelPropagation::propagate(const AdjacencyList& out, const AdjacencyList& in) {
+    grow(out.size());
+    Stats stats;
+    const unsigned threads = ParallelExecutor::threadCount();
+    std::vector<std::vector<int>> next(threads);
+    std::vector<std::vector<std::pair<int, long long>>> scratch(threads);
+    std::vector<size_t> changed(threads, 0);
+
+    while (!pending.empty() && stats.rounds < MAX_ROUNDS) {
+        stats.rounds++;
+        stats.evaluated += pending.size();
+        ParallelExecutor::forEachChunk(pending.size(), GRAIN, [&](size_t first, size_t last, unsigned thread) {
+            auto& weights = scratch[thread];
+            for (size_t i = first; i < last; i++) {
+                const int v = pending[i];
+                queued[v].store(false, std::memory_order_relaxed);
+
+                // Total weight per neighboring label
+                weights.clear();
+                for (const auto& [w, weight] : out[v]) {
+                    if (w != v) weights.push_back({ label[w].load(std::memory_order_relaxed), weight });
+                }
+                for (const auto& [w, weight] : in[v]) {
+                    if (w != v) weights.push_back({ label[w].load(std::memory_order_relaxed), weight });
+                }
+                if (weights.empty()) continue;
+                std::sort(weights.begin(), weights.end(),
+                    [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                const int current = label[v].load(std::memory_order_relaxed);
+                int best = current;
+                long long bestWeight = -1;
+                long long currentWeight = 0;
+                for (size_t j = 0; j < weights.size();) {
+                    const int candidate = weights[j].first;
+                    long long total = 0;
+                    for (; j < weights.size() && weights[j].first == candidate; j++) total += weights[j].second;
+                    if (candidate == current) currentWeight = total;
+                    if (total > bestWeight) {
+                        bestWeight = total;
+                        best = candidate;
+                    }
+                }
+                if (best == current || bestWeight <= currentWeight) continue;
+
+                label[v].store(best, std::memory_order_relaxed);
+                changed[thread]++;
+                auto wake = [&](int w) {
+                    if (!queued[w].exchange(true, std::memory_order_relaxed)) next[thread].push_back(w);
+                };
+                for (const auto& edge : out[v]) wake(edge.first);
+                for (const auto& edge : in[v]) wake(edge.first);
+            }
+        });
+
+        pending.clear();
+        for (auto& part : next) {
+            pending.insert(pending.end(), part.begin(), part.end());
+            part.clear();
+        }
+    }
+
+    for (size_t count : changed) stats.changed += count;
+    return stats;
+}
+
+std::vector<int> LabelPropagation::labels() const {
+    std::vector<int> result(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) {
+        result[v] = label[v].load(std::memory_order_relaxed);
+    }
+    return result;
+}
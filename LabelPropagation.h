@@ -0,0 +1,61 @@
+// File: include/LabelPropagation.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Label propagation communities kept current while the graph grows. Every
+// vertex repeatedly adopts the label carrying the most edge weight among its
+// neighbors (in- and out-edges alike), keeping its own label on ties.
+// Workers update labels asynchronously in place, and a vertex is only
+// re-evaluated after a neighbor's label changed or an edge was added at it,
+// so a refresh after a batch of insertions costs time proportional to the
+// region whose labels actually move. Results are approximate by design.
+class LabelPropagation {
+public:
+    using AdjacencyList = std::vector<std::vector<std::pair<int, int>>>;
+    // Rounds per propagate call; vertices still pending carry over
+    static constexpr int MAX_ROUNDS = 32;
+
+    struct Stats {
+        size_t evaluated = 0;   // Vertices whose neighborhood was scanned
+        size_t changed = 0;     // Label changes
+        int rounds = 0;
+    };
+
+private:
+    std::unique_ptr<std::atomic<int>[]> label;
+    // Set while a vertex is in the pending frontier
+    std::unique_ptr<std::atomic<bool>[]> queued;
+    size_t vertexCount;
+    size_t capacity;
+    std::vector<int> pending;
+    bool initialized;
+
+    // New vertices start in their own community
+    void grow(size_t count);
+
+public:
+    LabelPropagation();
+    LabelPropagation(const LabelPropagation& other);
+    LabelPropagation& operator=(const LabelPropagation& other);
+    LabelPropagation(LabelPropagation&&) = default;
+    LabelPropagation& operator=(LabelPropagation&&) = default;
+
+    bool isInitialized() const { return initialized; }
+    // Restarts from singleton labels with every vertex pending
+    void reset(size_t count);
+    // Queues vertex for re-evaluation, e.g. after an edge was added at it
+    void touch(int vertex);
+    // Runs rounds over the pending vertices until none remain or MAX_ROUNDS
+    Stats propagate(const AdjacencyList& out, const AdjacencyList& in);
+
+    size_t pendingCount() const { return pending.size(); }
+    int getLabel(int vertex) const {
+        return static_cast<size_t>(vertex) < vertexCount ? label[vertex].load(std::memory_order_relaxed) : vertex;
+    }
+    std::vector<int> labels() const;
+};
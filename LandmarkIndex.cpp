@@ -0,0 +1,131 @@
+// File: src/LandmarkIndex.cpp
+#include "LandmarkIndex.h"
+#include <algorithm>
+#include <array>
+#include "ParallelExecutor.h"
+
+namespace {
+    const int INF = DijkstraWorkspace::INF;
+
+    // Copies the labels of a completed full search into a table row
+    void copyDistances(const DijkstraWorkspace& workspace, int vertexCount, int* row) {
+        for (int v = 0; v < vertexCount; v++) {
+            row[v] = workspace.getDistance(v);
+        }
+    }
+}
+
+LandmarkIndex::LandmarkIndex(const CSRGraph& graph, int landmarkCount)
+    : vertexCount(graph.numVertices()) {
+    const size_t n = static_cast<size_t>(vertexCount);
+
+    // Start from the farthest vertex reachable from the best-connected one
+    int start = -1;
+    int bestDegree = 0;
+    for (int v = 0; v < vertexCount; v++) {
+        int degree = graph.degree(v) + graph.inDegree(v);
+        if (degree > bestDegree) {
+            bestDegree = degree;
+            start = v;
+        }
+    }
+    if (start < 0 || landmarkCount <= 0) return;
+
+    DijkstraWorkspace workspace;
+    workspace.run(graph, start, -1);
+    int candidate = start;
+    for (int v = 0; v < vertexCount; v++) {
+        int dist = workspace.getDistance(v);
+        if (dist != INF && dist > workspace.getDistance(candidate)) candidate = v;
+    }
+
+    // Farthest-point selection: each new landmark maximizes its distance to
+    // the nearest landmark so far. Vertices no landmark reaches count as
+    // infinitely far, which spreads landmarks over disconnected regions.
+    std::vector<int> nearest(n, INF);
+    while (static_cast<int>(landmarks.size()) < landmarkCount) {
+        landmarks.push_back(candidate);
+        fromLandmark.resize(landmarks.size() * n);
+        workspace.run(graph, candidate, -1);
+        int* row = fromLandmark.data() + (landmarks.size() - 1) * n;
+        copyDistances(workspace, vertexCount, row);
+
+        candidate = -1;
+        for (int v = 0; v < vertexCount; v++) {
+            nearest[v] = std::min(nearest[v], row[v]);
+            if (nearest[v] == 0 || graph.degree(v) + graph.inDegree(v) == 0) continue;
+            if (candidate < 0 || nearest[v] > nearest[candidate]) candidate = v;
+        }
+        if (candidate < 0) break;
+    }
+
+    toLandmark.resize(landmarks.size() * n);
+    ParallelExecutor::forEachChunk(landmarks.size(), 1, [&](size_t first, size_t last, unsigned) {
+        DijkstraWorkspace backward;
+        for (size_t l = first; l < last; l++) {
+            backward.run(graph, landmarks[l], -1, DijkstraWorkspace::Direction::BACKWARD);
+            copyDistances(backward, vertexCount, toLandmark.data() + l * n);
+        }
+    });
+}
+
+int LandmarkIndex::landmarkBound(int l, int from, int to) const {
+    const size_t row = static_cast<size_t>(l) * vertexCount;
+    const int fromFrom = fromLandmark[row + from];
+    const int fromTo = fromLandmark[row + to];
+    const int toFrom = toLandmark[row + from];
+    const int toTo = toLandmark[row + to];
+
+    // L reaches from but not to, or to reaches L but from does not: no path
+    if ((fromFrom != INF && fromTo == INF) || (toTo != INF && toFrom == INF)) return INF;
+
+    int bound = 0;
+    if (fromFrom != INF && fromTo != INF) bound = std::max(bound, fromTo - fromFrom);
+    if (toFrom != INF && toTo != INF) bound = std::max(bound, toFrom - toTo);
+    return bound;
+}
+
+int LandmarkIndex::query(const CSRGraph& graph, int source, int target,
+    DijkstraWorkspace& workspace) const {
+    // Keep the landmarks giving the best bound between the endpoints
+    std::array<int, ACTIVE_LANDMARKS> active;
+    std::array<int, ACTIVE_LANDMARKS> activeBound;
+    int activeCount = 0;
+    for (int l = 0; l < static_cast<int>(landmarks.size()); l++) {
+        int bound = landmarkBound(l, source, target);
+        if (bound == INF) {
+            workspace.beginQuery(graph.numVertices());
+            return INF;
+        }
+        int slot;
+        if (activeCount < ACTIVE_LANDMARKS) {
+            slot = activeCount++;
+        }
+        else if (bound > activeBound[ACTIVE_LANDMARKS - 1]) {
+            slot = ACTIVE_LANDMARKS - 1;
+        }
+        else {
+            continue;
+        }
+        for (; slot > 0 && activeBound[slot - 1] < bound; slot--) {
+            active[slot] = active[slot - 1];
+            activeBound[slot] = activeBound[slot - 1];
+        }
+        active[slot] = l;
+        activeBound[slot] = bound;
+    }
+
+    return workspace.runAStar(graph, source, target, [&](int vertex) {
+        int best = 0;
+        for (int i = 0; i < activeCount; i++) {
+            int bound = landmarkBound(active[i], vertex, target);
+            if (bound == INF) return INF;
+            best = std::max(best, bound);
+        }
+        return best;
+    });
+}
+
+size_t LandmarkIndex::memoryFootprint() const {
+    return (fromLandmark.size() + toLandmark.size() + landmarks.size()) * sizeof(int);
+}
@@ -0,0 +1,45 @@
+// File: include/LandmarkIndex.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+#include "DijkstraWorkspace.h"
+
+// ALT (A*, landmarks, triangle inequality) index over a CSRGraph snapshot.
+// For every landmark L it stores d(L, v) and d(v, L) for all vertices, which
+// bound any distance from below:
+//     d(v, t) >= d(L, t) - d(L, v)   and   d(v, t) >= d(v, L) - d(t, L)
+// Queries run A* with the tightest of these bounds as the potential, which
+// typically settles a small fraction of the vertices plain Dijkstra does.
+//
+// Landmarks are picked by farthest-point selection so they sit on the
+// periphery of the graph. Tables take 2 * landmarks * vertices ints.
+class LandmarkIndex {
+public:
+    static constexpr int DEFAULT_LANDMARKS = 16;
+    // Landmarks consulted per query, chosen by their bound between the endpoints
+    static constexpr int ACTIVE_LANDMARKS = 4;
+
+private:
+    int vertexCount;
+    std::vector<int> landmarks;
+    // Row-major by landmark: fromLandmark[l * vertexCount + v] = d(landmarks[l], v)
+    std::vector<int> fromLandmark;
+    // toLandmark[l * vertexCount + v] = d(v, landmarks[l])
+    std::vector<int> toLandmark;
+
+    // Lower bound on d(from, to) from landmark l; INF if to is unreachable
+    int landmarkBound(int l, int from, int to) const;
+
+public:
+    // Selects up to landmarkCount landmarks among non-isolated vertices and
+    // fills their distance tables (the backward tables in parallel)
+    LandmarkIndex(const CSRGraph& graph, int landmarkCount);
+
+    // Point-to-point distance via A*; the path is left in workspace
+    int query(const CSRGraph& graph, int source, int target, DijkstraWorkspace& workspace) const;
+
+    const std::vector<int>& getLandmarks() const { return landmarks; }
+    size_t memoryFootprint() const;
+};
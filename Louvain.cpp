@@ -0,0 +1,268 @@
+// File: src/Louvain.cpp
+#include "Louvain.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include "ParallelExecutor.h"
+
+namespace {
+    const size_t GRAIN = 256;
+
+    // Symmetric weighted graph of one level. Every undirected edge appears
+    // in both endpoint lists; a community's internal weight becomes a self
+    // loop of the aggregated vertex.
+    struct LevelGraph {
+        int vertexCount = 0;
+        std::vector<size_t> offsets;
+        std::vector<int> targets;
+        std::vector<long long> weights;
+        std::vector<long long> degree;
+        long long totalWeight = 0;  // Sum of all degrees, i.e. 2m
+
+        void finish() {
+            degree.assign(vertexCount, 0);
+            ParallelExecutor::forEachChunk(vertexCount, GRAIN, [&](size_t first, size_t last, unsigned) {
+                for (size_t v = first; v < last; v++) {
+                    for (size_t e = offsets[v]; e < offsets[v + 1]; e++) degree[v] += weights[e];
+                }
+            });
+            totalWeight = std::accumulate(degree.begin(), degree.end(), 0LL);
+        }
+    };
+
+    LevelGraph symmetrize(const CSRGraph& graph) {
+        LevelGraph level;
+        level.vertexCount = graph.numVertices();
+        level.offsets.assign(level.vertexCount + 1, 0);
+        for (int v = 0; v < level.vertexCount; v++) {
+            size_t count = 0;
+            for (auto e = graph.edgeBegin(v), last = graph.edgeEnd(v); e < last; ++e) count += graph.weight(e) > 0;
+            for (auto e = graph.inEdgeBegin(v), last = graph.inEdgeEnd(v); e < last; ++e) count += graph.inWeight(e) > 0;
+            level.offsets[v + 1] = level.offsets[v] + count;
+        }
+        level.targets.resize(level.offsets.back());
+        level.weights.resize(level.offsets.back());
+        ParallelExecutor::forEachChunk(level.vertexCount, GRAIN, [&](size_t first, size_t last, unsigned) {
+            for (size_t v = first; v < last; v++) {
+                size_t slot = level.offsets[v];
+                const int vertex = static_cast<int>(v);
+                for (auto e = graph.edgeBegin(vertex), end = graph.edgeEnd(vertex); e < end; ++e) {
+                    if (graph.weight(e) <= 0) continue;
+                    level.targets[slot] = graph.target(e);
+                    level.weights[slot++] = graph.weight(e);
+                }
+                for (auto e = graph.inEdgeBegin(vertex), end = graph.inEdgeEnd(vertex); e < end; ++e) {
+                    if (graph.inWeight(e) <= 0) continue;
+                    level.targets[slot] = graph.source(e);
+                    level.weights[slot++] = graph.inWeight(e);
+                }
+            }
+        });
+        level.finish();
+        return level;
+    }
+
+    // Sorts (community, weight) pairs and merges equal communities in place
+    void accumulate(std::vector<std::pair<int, long long>>& entries) {
+        std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+        size_t out = 0;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (out > 0 && entries[out - 1].first == entries[i].first) entries[out - 1].second += entries[i].second;
+            else entries[out++] = entries[i];
+        }
+        entries.resize(out);
+    }
+
+    double modularity(const LevelGraph& level, const std::vector<int>& community) {
+        if (level.totalWeight == 0) return 0;
+        const double total = static_cast<double>(level.totalWeight);
+        std::vector<long long> internal(ParallelExecutor::threadCount(), 0);
+        std::vector<long long> sums(level.vertexCount, 0);
+        for (int v = 0; v < level.vertexCount; v++) {
+            sums[community[v]] += level.degree[v];
+        }
+        ParallelExecutor::forEachChunk(level.vertexCount, GRAIN, [&](size_t first, size_t last, unsigned thread) {
+            for (size_t v = first; v < last; v++) {
+                for (size_t e = level.offsets[v]; e < level.offsets[v + 1]; e++) {
+                    if (community[level.targets[e]] == community[v]) internal[thread] += level.weights[e];
+                }
+            }
+        });
+        double q = std::accumulate(internal.begin(), internal.end(), 0LL) / total;
+        for (long long sum : sums) {
+            q -= (sum / total) * (sum / total);
+        }
+        return q;
+    }
+
+    // Parallel local moving; returns the number of sweeps run and leaves
+    // each vertex's community (a vertex ID of this level) in community
+    int moveVertices(const LevelGraph& level, std::vector<int>& community, double& quality) {
+        const int n = level.vertexCount;
+        const double total = static_cast<double>(level.totalWeight);
+        std::unique_ptr<std::atomic<int>[]> assigned(new std::atomic<int>[n]);
+        std::unique_ptr<std::atomic<long long>[]> sum(new std::atomic<long long>[n]);
+        // Vertices whose neighborhood changed since they were last considered
+        std::unique_ptr<std::atomic<bool>[]> active(new std::atomic<bool>[n]);
+        for (int v = 0; v < n; v++) {
+            assigned[v].store(v, std::memory_order_relaxed);
+            active[v].store(true, std::memory_order_relaxed);
+            sum[v].store(level.degree[v], std::memory_order_relaxed);
+        }
+        community.resize(n);
+        std::iota(community.begin(), community.end(), 0);
+        quality = modularity(level, community);
+        if (level.totalWeight == 0) return 0;
+
+        std::vector<std::vector<std::pair<int, long long>>> scratch(ParallelExecutor::threadCount());
+        int sweeps = 0;
+        while (sweeps < Louvain::MAX_SWEEPS) {
+            sweeps++;
+            std::atomic<size_t> moved(0);
+            ParallelExecutor::forEachChunk(n, GRAIN, [&](size_t first, size_t last, unsigned thread) {
+                auto& links = scratch[thread];
+                size_t movedHere = 0;
+                for (size_t v = first; v < last; v++) {
+                    if (!active[v].exchange(false, std::memory_order_relaxed)) continue;
+                    const int current = assigned[v].load(std::memory_order_relaxed);
+                    const long long k = level.degree[v];
+                    links.clear();
+                    for (size_t e = level.offsets[v]; e < level.offsets[v + 1]; e++) {
+                        if (level.targets[e] == static_cast<int>(v)) continue;
+                        links.push_back({ assigned[level.targets[e]].load(std::memory_order_relaxed), level.weights[e] });
+                    }
+                    accumulate(links);
+
+                    long long toCurrent = 0;
+                    for (const auto& [c, w] : links) {
+                        if (c == current) toCurrent = w;
+                    }
+                    // Gain of joining c relative to v standing alone, scaled by 2m
+                    auto gain = [&](long long w, long long communitySum) {
+                        return static_cast<double>(w) - static_cast<double>(k) * communitySum / total;
+                    };
+                    int best = current;
+                    double bestGain = gain(toCurrent, sum[current].load(std::memory_order_relaxed) - k);
+                    for (const auto& [c, w] : links) {
+                        if (c == current) continue;
+                        double g = gain(w, sum[c].load(std::memory_order_relaxed));
+                        if (g > bestGain) {
+                            bestGain = g;
+                            best = c;
+                        }
+                    }
+
+                    if (best != current) {
+                        assigned[v].store(best, std::memory_order_relaxed);
+                        sum[current].fetch_sub(k, std::memory_order_relaxed);
+                        sum[best].fetch_add(k, std::memory_order_relaxed);
+                        for (size_t e = level.offsets[v]; e < level.offsets[v + 1]; e++) {
+                            active[level.targets[e]].store(true, std::memory_order_relaxed);
+                        }
+                        movedHere++;
+                    }
+                }
+                moved += movedHere;
+            });
+
+            std::vector<int> next(n);
+            for (int v = 0; v < n; v++) {
+                next[v] = assigned[v].load(std::memory_order_relaxed);
+            }
+            const double nextQuality = modularity(level, next);
+            // Concurrent moves can occasionally lower modularity; keep the best
+            if (nextQuality > quality) community.swap(next);
+            const double improvement = nextQuality - quality;
+            quality = std::max(quality, nextQuality);
+            if (moved.load() == 0 || improvement < Louvain::MIN_GAIN) break;
+        }
+        return sweeps;
+    }
+
+    // Collapses each community into one vertex of the next level
+    LevelGraph aggregate(const LevelGraph& level, const std::vector<int>& community, int count) {
+        std::vector<int> memberOffsets(count + 1, 0);
+        for (int c : community) memberOffsets[c + 1]++;
+        std::partial_sum(memberOffsets.begin(), memberOffsets.end(), memberOffsets.begin());
+        std::vector<int> members(community.size());
+        std::vector<int> fill(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (int v = 0; v < level.vertexCount; v++) {
+            members[fill[community[v]]++] = v;
+        }
+
+        std::vector<std::vector<std::pair<int, long long>>> rows(count);
+        ParallelExecutor::forEachChunk(count, GRAIN / 16, [&](size_t first, size_t last, unsigned) {
+            for (size_t c = first; c < last; c++) {
+                auto& row = rows[c];
+                for (int m = memberOffsets[c]; m < memberOffsets[c + 1]; m++) {
+                    const int v = members[m];
+                    for (size_t e = level.offsets[v]; e < level.offsets[v + 1]; e++) {
+                        row.push_back({ community[level.targets[e]], level.weights[e] });
+                    }
+                }
+                accumulate(row);
+            }
+        });
+
+        LevelGraph next;
+        next.vertexCount = count;
+        next.offsets.assign(count + 1, 0);
+        for (int c = 0; c < count; c++) {
+            next.offsets[c + 1] = next.offsets[c] + rows[c].size();
+        }
+        next.targets.resize(next.offsets.back());
+        next.weights.resize(next.offsets.back());
+        ParallelExecutor::forEachChunk(count, GRAIN / 16, [&](size_t first, size_t last, unsigned) {
+            for (size_t c = first; c < last; c++) {
+                size_t slot = next.offsets[c];
+                for (const auto& [target, weight] : rows[c]) {
+                    next.targets[slot] = target;
+                    next.weights[slot++] = weight;
+                }
+                std::vector<std::pair<int, long long>>().swap(rows[c]);
+            }
+        });
+        next.finish();
+        return next;
+    }
+}
+
+Louvain::Result Louvain::run(const CSRGraph& graph) {
+    Result result;
+    result.community.resize(graph.numVertices());
+    std::iota(result.community.begin(), result.community.end(), 0);
+    result.count = graph.numVertices();
+
+    LevelGraph level = symmetrize(graph);
+    std::vector<int> community;
+    for (int depth = 0; depth < MAX_LEVELS; depth++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        Level stats;
+        stats.sweeps = moveVertices(level, community, stats.modularity);
+
+        // Renumber the surviving communities densely
+        std::vector<int> dense(level.vertexCount, -1);
+        int count = 0;
+        for (int& c : community) {
+            if (dense[c] < 0) dense[c] = count++;
+            c = dense[c];
+        }
+        for (int& c : result.community) {
+            c = community[c];
+        }
+        result.count = count;
+        result.modularity = stats.modularity;
+        stats.communities = count;
+
+        const bool merged = count < level.vertexCount;
+        if (merged) level = aggregate(level, community, count);
+        stats.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        result.levels.push_back(stats);
+        if (!merged) break;
+    }
+    return result;
+}
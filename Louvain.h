@@ -0,0 +1,42 @@
+// File: include/Louvain.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "CSRGraph.h"
+
+// Multi-level Louvain modularity optimization over a CSRGraph snapshot. Edge
+// directions are ignored: u -> v and v -> u add up to one undirected weight,
+// and edges with non-positive weight are skipped.
+//
+// Each level runs asynchronous parallel local moving (as in PLM, Staudt and
+// Meyerhenke): workers move vertices to the neighboring community with the
+// best modularity gain against shared, atomically updated community totals.
+// Only vertices with a neighbor that moved are revisited in later sweeps.
+// Concurrent moves can rarely undo each other, so a sweep's assignment is
+// only kept if it raises modularity. Sweeps stop once modularity gains less
+// than MIN_GAIN; the communities then become the vertices of the next
+// level, until a level merges nothing.
+class Louvain {
+public:
+    static constexpr double MIN_GAIN = 1e-6;
+    static constexpr int MAX_SWEEPS = 32;
+    static constexpr int MAX_LEVELS = 32;
+
+    struct Level {
+        int communities = 0;
+        double modularity = 0;
+        int sweeps = 0;
+        double seconds = 0;
+    };
+
+    struct Result {
+        // Community of each dense vertex, numbered 0..count-1
+        std::vector<int> community;
+        int count = 0;
+        double modularity = 0;
+        std::vector<Level> levels;
+    };
+
+    static Result run(const CSRGraph& graph);
+};
@@ -0,0 +1,75 @@
+// File: src/MappedFile.cpp
+#include "MappedFile.h"
+#include <stdexcept>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& filename)
+    : address(nullptr), length(0) {
+#if defined(_WIN32)
+    mapping = nullptr;
+    file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size)) {
+        length = static_cast<size_t>(size.QuadPart);
+    }
+    if (length == 0) return;
+
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) {
+        address = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0) {
+        length = static_cast<size_t>(info.st_size);
+    }
+    if (length > 0) {
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED) {
+            address = static_cast<const char*>(mapped);
+        }
+    }
+    ::close(fd);
+    if (length == 0) return;
+#endif
+    if (!address) {
+        release();
+        throw std::runtime_error("Cannot map file: " + filename);
+    }
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+void MappedFile::release() {
+#if defined(_WIN32)
+    if (address) UnmapViewOfFile(address);
+    if (mapping) CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (address) munmap(const_cast<char*>(address), length);
+#endif
+    address = nullptr;
+}
@@ -0,0 +1,30 @@
+// File: include/MappedFile.h
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file, unmapped on destruction.
+// Throws std::runtime_error if the file cannot be opened or mapped.
+class MappedFile {
+private:
+    const char* address;
+    size_t length;
+#if defined(_WIN32)
+    void* file;     // HANDLE
+    void* mapping;  // HANDLE
+#endif
+
+    void release();
+
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Null for an empty file
+    const char* data() const { return address; }
+    size_t size() const { return length; }
+};
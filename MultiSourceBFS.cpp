@@ -0,0 +1,85 @@
+// File: src/MultiSourceBFS.cpp
+#include "MultiSourceBFS.h"
+#include <algorithm>
+#include "ParallelExecutor.h"
+
+MultiSourceBFS::Result MultiSourceBFS::run(const CSRGraph& graph, const std::vector<int>& sources) {
+    const size_t vertexCount = static_cast<size_t>(graph.numVertices());
+    Result result;
+    result.distances.assign(sources.size() * vertexCount, -1);
+    result.batches = (sources.size() + BATCH_SIZE - 1) / BATCH_SIZE;
+    std::vector<size_t> scanned(ParallelExecutor::threadCount(), 0);
+
+    ParallelExecutor::forEachChunk(result.batches, 1, [&](size_t first, size_t last, unsigned thread) {
+        // seen: searches that reached the vertex; next: searches whose next
+        // frontier contains it
+        std::vector<std::uint64_t> seen(vertexCount);
+        std::vector<std::uint64_t> next(vertexCount);
+        // Every frontier with its masks, level by level. Distances are written
+        // from this log one source row at a time afterwards, because scattering
+        // them across 64 rows during the traversal thrashes the cache.
+        std::vector<int> logVertices;
+        std::vector<std::uint64_t> logMasks;
+        std::vector<size_t> levelStart;
+
+        for (size_t batch = first; batch < last; batch++) {
+            const size_t base = batch * BATCH_SIZE;
+            const size_t width = std::min(BATCH_SIZE, sources.size() - base);
+            std::fill(seen.begin(), seen.end(), 0);
+            logVertices.clear();
+            levelStart.assign(1, 0);
+
+            for (size_t i = 0; i < width; i++) {
+                int source = sources[base + i];
+                if (source < 0 || static_cast<size_t>(source) >= vertexCount) continue;
+                if (next[source] == 0) logVertices.push_back(source);
+                seen[source] |= std::uint64_t(1) << i;
+                next[source] |= std::uint64_t(1) << i;
+            }
+            logMasks.clear();
+            for (int vertex : logVertices) {
+                logMasks.push_back(next[vertex]);
+                next[vertex] = 0;
+            }
+
+            while (levelStart.back() < logVertices.size()) {
+                const size_t frontierBegin = levelStart.back();
+                const size_t frontierEnd = logVertices.size();
+                levelStart.push_back(frontierEnd);
+                for (size_t f = frontierBegin; f < frontierEnd; f++) {
+                    const int vertex = logVertices[f];
+                    const std::uint64_t searches = logMasks[f];
+                    scanned[thread] += graph.degree(vertex);
+                    for (auto e = graph.edgeBegin(vertex), end = graph.edgeEnd(vertex); e < end; ++e) {
+                        const int neighbor = graph.target(e);
+                        const std::uint64_t discovered = searches & ~seen[neighbor];
+                        if (discovered == 0) continue;
+                        if (next[neighbor] == 0) logVertices.push_back(neighbor);
+                        next[neighbor] |= discovered;
+                        seen[neighbor] |= discovered;
+                    }
+                }
+
+                for (size_t f = frontierEnd; f < logVertices.size(); f++) {
+                    logMasks.push_back(next[logVertices[f]]);
+                    next[logVertices[f]] = 0;
+                }
+            }
+
+            for (size_t i = 0; i < width; i++) {
+                int* row = result.distances.data() + (base + i) * vertexCount;
+                const std::uint64_t bit = std::uint64_t(1) << i;
+                for (size_t level = 0; level + 1 < levelStart.size(); level++) {
+                    for (size_t f = levelStart[level]; f < levelStart[level + 1]; f++) {
+                        if (logMasks[f] & bit) row[logVertices[f]] = static_cast<int>(level);
+                    }
+                }
+            }
+        }
+    });
+
+    for (size_t count : scanned) {
+        result.edgesScanned += count;
+    }
+    return result;
+}
@@ -0,0 +1,29 @@
+// File: include/MultiSourceBFS.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CSRGraph.h"
+
+// Multi-source BFS (Then et al., "The More the Merrier"). Up to 64 searches
+// share one traversal: every vertex carries a 64-bit mask of the searches
+// that have seen it and of those whose frontier currently contains it, so an
+// edge is scanned once per level for the whole batch instead of once per
+// source. Larger source sets are split into batches that run concurrently on
+// the worker pool, each with its own bitsets.
+class MultiSourceBFS {
+public:
+    static constexpr size_t BATCH_SIZE = 64;
+
+    struct Result {
+        // Row-major sources x vertices hop distances, -1 if unreachable as in
+        // BreadthFirstSearch
+        std::vector<int> distances;
+        size_t edgesScanned = 0;
+        size_t batches = 0;
+    };
+
+    // Dense sources; negative entries produce all-unreachable rows
+    static Result run(const CSRGraph& graph, const std::vector<int>& sources);
+};
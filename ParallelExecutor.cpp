@@ -0,0 +1,109 @@
+// File: src/ParallelExecutor.cpp
+#include "ParallelExecutor.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace {
+    thread_local bool runningChunk = false;
+
+    // Threads are created on demand and kept until exit. Each call publishes
+    // its job under a new generation; sleeping workers claim participant
+    // indices until the call has enough, and the caller waits for all of
+    // them to report back before the job goes out of scope.
+    class WorkerPool {
+    private:
+        std::mutex submitMutex;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable finished;
+        std::vector<std::thread> threads;
+        const std::function<void(unsigned)>* job = nullptr;
+        unsigned participants = 0;
+        unsigned nextIndex = 0;
+        unsigned pending = 0;
+        std::uint64_t generation = 0;
+        bool stopping = false;
+
+        void workerLoop() {
+            std::uint64_t seen = 0;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wake.wait(lock, [&] {
+                    return stopping || (generation != seen && nextIndex < participants);
+                });
+                if (stopping) return;
+                seen = generation;
+                const unsigned index = nextIndex++;
+                const std::function<void(unsigned)>& work = *job;
+                lock.unlock();
+                runningChunk = true;
+                work(index);
+                runningChunk = false;
+                lock.lock();
+                if (--pending == 0) finished.notify_one();
+            }
+        }
+
+    public:
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        void run(unsigned workers, const std::function<void(unsigned)>& work) {
+            std::lock_guard<std::mutex> turn(submitMutex);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                while (threads.size() + 1 < workers) {
+                    threads.emplace_back([this] { workerLoop(); });
+                }
+                job = &work;
+                participants = workers;
+                nextIndex = 1;
+                pending = workers - 1;
+                generation++;
+            }
+            wake.notify_all();
+
+            runningChunk = true;
+            work(0);
+            runningChunk = false;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&] { return pending == 0; });
+            job = nullptr;
+        }
+    };
+
+    WorkerPool& pool() {
+        static WorkerPool instance;
+        return instance;
+    }
+}
+
+unsigned ParallelExecutor::configuredThreads = 0;
+
+unsigned ParallelExecutor::threadCount() {
+    if (configuredThreads > 0) return configuredThreads;
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+void ParallelExecutor::setThreadCount(unsigned count) {
+    configuredThreads = count;
+}
+
+bool ParallelExecutor::insidePool() {
+    return runningChunk;
+}
+
+void ParallelExecutor::runOnPool(unsigned workers, const std::function<void(unsigned)>& work) {
+    pool().run(workers, work);
+}
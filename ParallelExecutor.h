@@ -0,0 +1,70 @@
+// File: include/ParallelExecutor.h
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Minimal fork-join helper used by the parallel algorithms. Work is split into
+// chunks that worker threads claim dynamically, so uneven chunks balance out.
+// The workers form a persistent pool that is started on first use and sleeps
+// between calls, so short parallel phases do not pay for thread creation.
+// Calls from different threads take turns on the pool; a call made from
+// inside a running chunk runs inline on the calling worker.
+class ParallelExecutor {
+private:
+    static unsigned configuredThreads;
+
+    // Runs work(0) on the caller and work(1..workers-1) on pool threads,
+    // returning once all of them have finished
+    static void runOnPool(unsigned workers, const std::function<void(unsigned)>& work);
+
+public:
+    // Number of worker threads; defaults to the hardware concurrency
+    static unsigned threadCount();
+    // Overrides the worker count (0 restores the hardware default)
+    static void setThreadCount(unsigned count);
+    // Whether the calling thread is running a chunk of a parallel call
+    static bool insidePool();
+
+    // Calls fn(begin, end, threadIndex) for consecutive chunks of at most
+    // grain items covering [0, count). Exceptions are rethrown once every
+    // worker has finished.
+    template <typename Fn>
+    static void forEachChunk(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0) return;
+        grain = std::max<size_t>(grain, 1);
+        const size_t chunks = (count + grain - 1) / grain;
+        const unsigned workers = static_cast<unsigned>(
+            std::min<size_t>(threadCount(), chunks));
+
+        if (workers <= 1 || insidePool()) {
+            fn(size_t(0), count, 0u);
+            return;
+        }
+
+        std::atomic<size_t> nextChunk(0);
+        std::vector<std::exception_ptr> errors(workers);
+        auto work = [&](unsigned threadIndex) {
+            try {
+                for (size_t chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+                    size_t begin = chunk * grain;
+                    fn(begin, std::min(begin + grain, count), threadIndex);
+                }
+            }
+            catch (...) {
+                errors[threadIndex] = std::current_exception();
+                nextChunk = chunks;
+            }
+        };
+
+        runOnPool(workers, work);
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+};
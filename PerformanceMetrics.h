@@ -3,11 +3,14 @@
 
 #include <chrono>
 #include <cstddef>
+#include <map>
+#include <string>
 
 struct PerformanceMetrics {
     std::chrono::duration<double> executionTime;
     size_t nodesProcessed;
     size_t memoryUsed;  // in bytes
+    std::map<std::string, double> counters;  // Operation-specific values (throughput, hit counts, ...)
 
     PerformanceMetrics();
 };
\ No newline at end of file
@@ -0,0 +1,158 @@
+// File: src/ReachabilityIndex.cpp
+#include "ReachabilityIndex.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include "ParallelExecutor.h"
+#include "StronglyConnectedComponents.h"
+
+ReachabilityIndex::ReachabilityIndex(const CSRGraph& graph) {
+    StronglyConnectedComponents::Result scc = StronglyConnectedComponents::tarjan(graph);
+    component = std::move(scc.component);
+    const int count = scc.count;
+
+    // Group vertices by component, then collect each component's distinct
+    // outgoing DAG edges
+    std::vector<int> memberOffsets(count + 1, 0);
+    for (int c : component) memberOffsets[c + 1]++;
+    std::partial_sum(memberOffsets.begin(), memberOffsets.end(), memberOffsets.begin());
+    std::vector<int> members(component.size());
+    std::vector<int> fill(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (int v = 0; v < graph.numVertices(); v++) {
+        members[fill[component[v]]++] = v;
+    }
+
+    std::vector<int> lastSource(count, -1);
+    dagOffsets.assign(count + 1, 0);
+    for (int c = 0; c < count; c++) {
+        for (int m = memberOffsets[c]; m < memberOffsets[c + 1]; m++) {
+            const int v = members[m];
+            for (auto e = graph.edgeBegin(v), last = graph.edgeEnd(v); e < last; ++e) {
+                const int next = component[graph.target(e)];
+                if (next == c || lastSource[next] == c) continue;
+                lastSource[next] = c;
+                dagTargets.push_back(next);
+            }
+        }
+        dagOffsets[c + 1] = dagTargets.size();
+    }
+
+    // Successors have lower IDs, so one ascending pass settles every height
+    height.assign(count, 0);
+    for (int c = 0; c < count; c++) {
+        for (size_t e = dagOffsets[c]; e < dagOffsets[c + 1]; e++) {
+            height[c] = std::max(height[c], height[dagTargets[e]] + 1);
+        }
+    }
+
+    // Each labeling is an independent randomized DFS over the DAG
+    labels.assign(static_cast<size_t>(count) * LABELINGS * 3, 0);
+    ParallelExecutor::forEachChunk(LABELINGS, 1, [&](size_t first, size_t last, unsigned) {
+        std::vector<char> visited(count);
+        std::vector<int> roots(count);
+        // (component, edges explored so far, first edge to explore)
+        std::vector<std::tuple<int, size_t, size_t>> stack;
+
+        for (size_t labeling = first; labeling < last; labeling++) {
+            std::mt19937 rng(static_cast<unsigned>(labeling));
+            std::fill(visited.begin(), visited.end(), 0);
+            std::iota(roots.rbegin(), roots.rend(), 0);
+            if (labeling > 0) std::shuffle(roots.begin(), roots.end(), rng);
+
+            int rank = 0;
+            auto label = [&](int c) { return &labels[(static_cast<size_t>(c) * LABELINGS + labeling) * 3]; };
+            auto lowOf = [&](int c) -> int& { return label(c)[0]; };
+            auto postOf = [&](int c) -> int& { return label(c)[2]; };
+            auto enter = [&](int c) {
+                visited[c] = 1;
+                lowOf(c) = count;
+                // Ranks handed out from here until c finishes belong to its subtree
+                label(c)[1] = rank;
+                const size_t degree = dagOffsets[c + 1] - dagOffsets[c];
+                stack.emplace_back(c, 0, labeling > 0 && degree > 0 ? rng() % degree : 0);
+            };
+
+            for (int root : roots) {
+                if (visited[root]) continue;
+                enter(root);
+                while (!stack.empty()) {
+                    auto& [c, explored, offset] = stack.back();
+                    const size_t degree = dagOffsets[c + 1] - dagOffsets[c];
+                    if (explored < degree) {
+                        const int next = dagTargets[dagOffsets[c] + (offset + explored++) % degree];
+                        if (!visited[next]) enter(next);
+                        else lowOf(c) = std::min(lowOf(c), lowOf(next));
+                        continue;
+                    }
+                    const int done = c;
+                    postOf(done) = rank++;
+                    lowOf(done) = std::min(lowOf(done), postOf(done));
+                    stack.pop_back();
+                    if (!stack.empty()) {
+                        int parent = std::get<0>(stack.back());
+                        lowOf(parent) = std::min(lowOf(parent), lowOf(done));
+                    }
+                }
+            }
+        }
+    });
+}
+
+bool ReachabilityIndex::mayReach(int from, int to) const {
+    // Edges only lead to lower IDs and strictly lower heights
+    if (from < to || height[from] <= height[to]) return false;
+    const int* a = labels.data() + static_cast<size_t>(from) * LABELINGS * 3;
+    const int* b = labels.data() + static_cast<size_t>(to) * LABELINGS * 3;
+    for (int l = 0; l < LABELINGS; l++) {
+        if (b[3 * l] < a[3 * l] || b[3 * l + 2] > a[3 * l + 2]) return false;
+    }
+    return true;
+}
+
+bool ReachabilityIndex::inSubtree(int from, int to) const {
+    const int* a = labels.data() + static_cast<size_t>(from) * LABELINGS * 3;
+    const int* b = labels.data() + static_cast<size_t>(to) * LABELINGS * 3;
+    for (int l = 0; l < LABELINGS; l++) {
+        if (a[3 * l + 1] <= b[3 * l + 2] && b[3 * l + 2] <= a[3 * l + 2]) return true;
+    }
+    return false;
+}
+
+bool ReachabilityIndex::reachable(int from, int to, SearchState& state) const {
+    if (from < 0 || to < 0) return false;
+    const int source = component[from];
+    const int target = component[to];
+    if (source == target) return true;
+    if (!mayReach(source, target)) return false;
+    if (inSubtree(source, target)) return true;
+
+    // Labels cannot decide: search the DAG, pruning by the labels
+    state.fallbackSearches++;
+    if (state.stamp.size() != height.size() || ++state.epoch == 0) {
+        state.stamp.assign(height.size(), 0);
+        state.epoch = 1;
+    }
+    state.stack.assign(1, source);
+    state.stamp[source] = state.epoch;
+    while (!state.stack.empty()) {
+        const int c = state.stack.back();
+        state.stack.pop_back();
+        for (size_t e = dagOffsets[c]; e < dagOffsets[c + 1]; e++) {
+            const int next = dagTargets[e];
+            if (next == target) return true;
+            if (state.stamp[next] == state.epoch || !mayReach(next, target)) continue;
+            if (inSubtree(next, target)) return true;
+            state.stamp[next] = state.epoch;
+            state.stack.push_back(next);
+        }
+    }
+    return false;
+}
+
+size_t ReachabilityIndex::memoryFootprint() const {
+    return component.capacity() * sizeof(int) + dagOffsets.capacity() * sizeof(size_t) +
+        dagTargets.capacity() * sizeof(int) + height.capacity() * sizeof(int) +
+        labels.capacity() * sizeof(int);
+}
@@ -0,0 +1,54 @@
+// File: include/ReachabilityIndex.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CSRGraph.h"
+
+// Reachability index over a CSRGraph snapshot. Vertices are collapsed into
+// their strongly connected components, and the condensation DAG is labeled
+// with GRAIL intervals: each of LABELINGS randomized post-order traversals
+// gives every component an interval [lowest descendant rank, own rank] that
+// contains the interval of everything it reaches. Together with a
+// topological height per component this answers most negative queries in
+// O(1). The same traversals also give each component the rank range of its
+// DFS subtree, a positive certificate, and queries neither label decides
+// fall back to a DFS over the DAG pruned by both.
+class ReachabilityIndex {
+public:
+    static constexpr int LABELINGS = 3;
+
+    // Scratch state for the fallback DFS, reused across queries
+    struct SearchState {
+        std::vector<std::uint32_t> stamp;
+        std::uint32_t epoch = 0;
+        std::vector<int> stack;
+        size_t fallbackSearches = 0;
+    };
+
+private:
+    std::vector<int> component;
+    // Condensation DAG in CSR form; edges go to lower component IDs
+    std::vector<size_t> dagOffsets;
+    std::vector<int> dagTargets;
+    // Longest path from each component to a sink
+    std::vector<int> height;
+    // (low, subtree low, post) triples, LABELINGS per component
+    std::vector<int> labels;
+
+    // False if from provably cannot reach to; true means "maybe"
+    bool mayReach(int from, int to) const;
+    // True if to lies in from's subtree in some labeling's DFS forest
+    bool inSubtree(int from, int to) const;
+
+public:
+    explicit ReachabilityIndex(const CSRGraph& graph);
+
+    // Whether dense vertex to is reachable from dense vertex from
+    bool reachable(int from, int to, SearchState& state) const;
+
+    int numComponents() const { return static_cast<int>(height.size()); }
+    size_t numCondensationEdges() const { return dagTargets.size(); }
+    size_t memoryFootprint() const;
+};
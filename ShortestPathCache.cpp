@@ -0,0 +1,80 @@
+// File: src/ShortestPathCache.cpp
+#include "ShortestPathCache.h"
+#include <algorithm>
+#include <limits>
+
+std::vector<int> ShortestPathCache::Tree::pathTo(int target) const {
+    std::vector<int> path;
+    // Unreachable, or behind a negative cycle
+    if (distance[target] == std::numeric_limits<int>::max() ||
+        distance[target] == std::numeric_limits<int>::min()) return path;
+    for (int at = target; at != -1; at = parent[at]) {
+        path.push_back(at);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+ShortestPathCache::ShortestPathCache(size_t capacity)
+    : capacity(capacity), version(0), hitCount(0), missCount(0) {}
+
+ShortestPathCache::ShortestPathCache(const ShortestPathCache& other)
+    : capacity(other.capacity), version(other.version), hitCount(0), missCount(0) {}
+
+ShortestPathCache& ShortestPathCache::operator=(const ShortestPathCache& other) {
+    if (this != &other) {
+        clear();
+        capacity = other.capacity;
+        version = other.version;
+        hitCount = 0;
+        missCount = 0;
+    }
+    return *this;
+}
+
+void ShortestPathCache::setCapacity(size_t trees) {
+    capacity = trees;
+    while (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+void ShortestPathCache::clear() {
+    entries.clear();
+    index.clear();
+}
+
+const ShortestPathCache::Tree* ShortestPathCache::find(int source, std::uint64_t graphVersion) {
+    if (graphVersion != version) {
+        clear();
+        version = graphVersion;
+    }
+    auto it = index.find(source);
+    if (it == index.end()) {
+        missCount++;
+        return nullptr;
+    }
+    hitCount++;
+    entries.splice(entries.begin(), entries, it->second);
+    return &it->second->second;
+}
+
+const ShortestPathCache::Tree& ShortestPathCache::insert(int source, std::uint64_t graphVersion, Tree tree) {
+    if (graphVersion != version) {
+        clear();
+        version = graphVersion;
+    }
+    auto it = index.find(source);
+    if (it != index.end()) {
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    entries.emplace_front(source, std::move(tree));
+    index[source] = entries.begin();
+    if (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return entries.front().second;
+}
@@ -0,0 +1,58 @@
+// File: include/ShortestPathCache.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Bounded LRU cache of single-source shortest path trees keyed by dense
+// source vertex, so repeated queries from one source answer any target
+// without searching. Entries are tagged with the graph version they were
+// computed for; a lookup under a newer version empties the cache.
+class ShortestPathCache {
+public:
+    struct Tree {
+        std::vector<int> distance;  // INT_MAX if unreachable
+        std::vector<int> parent;    // -1 for the source and unreachable vertices
+
+        // Dense path from the tree's source to target, empty if unreachable
+        std::vector<int> pathTo(int target) const;
+    };
+
+private:
+    using Entry = std::pair<int, Tree>;
+
+    size_t capacity;
+    std::uint64_t version;
+    // Most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<int, std::list<Entry>::iterator> index;
+    size_t hitCount;
+    size_t missCount;
+
+public:
+    // A capacity of 0 disables caching
+    explicit ShortestPathCache(size_t capacity = 0);
+    // Copies start empty with the same capacity; index holds list iterators
+    // that must not point into another cache
+    ShortestPathCache(const ShortestPathCache& other);
+    ShortestPathCache& operator=(const ShortestPathCache& other);
+    ShortestPathCache(ShortestPathCache&&) = default;
+    ShortestPathCache& operator=(ShortestPathCache&&) = default;
+
+    bool enabled() const { return capacity > 0; }
+    void setCapacity(size_t trees);
+    void clear();
+
+    // Returns the cached tree for source, or nullptr (counted as a miss)
+    const Tree* find(int source, std::uint64_t graphVersion);
+    // Stores a tree, evicting the least recently used one when full
+    const Tree& insert(int source, std::uint64_t graphVersion, Tree tree);
+
+    size_t size() const { return entries.size(); }
+    size_t hits() const { return hitCount; }
+    size_t misses() const { return missCount; }
+};
@@ -0,0 +1,273 @@
+// File: src/StronglyConnectedComponents.cpp
+#include "StronglyConnectedComponents.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include "ParallelExecutor.h"
+
+namespace {
+    const size_t GRAIN = 1024;
+
+    using LabelArray = std::unique_ptr<std::atomic<int>[]>;
+
+    // Tarjan over the vertices with component -1, continuing the numbering
+    // from count. Edges to already assigned vertices are ignored.
+    void tarjanRemaining(const CSRGraph& graph, std::vector<int>& component, int& count) {
+        const int vertexCount = graph.numVertices();
+        std::vector<int> index(vertexCount, -1);
+        std::vector<int> low(vertexCount, 0);
+        std::vector<char> onStack(vertexCount, 0);
+        std::vector<int> sccStack;
+        // Simulated recursion: (vertex, next out-edge to explore)
+        std::vector<std::pair<int, CSRGraph::EdgeIndex>> callStack;
+        int counter = 0;
+
+        auto discover = [&](int vertex) {
+            index[vertex] = low[vertex] = counter++;
+            sccStack.push_back(vertex);
+            onStack[vertex] = 1;
+            callStack.push_back({ vertex, graph.edgeBegin(vertex) });
+        };
+
+        for (int root = 0; root < vertexCount; root++) {
+            if (index[root] != -1 || component[root] != -1) continue;
+            discover(root);
+
+            while (!callStack.empty()) {
+                const int vertex = callStack.back().first;
+                CSRGraph::EdgeIndex& edge = callStack.back().second;
+
+                if (edge < graph.edgeEnd(vertex)) {
+                    const int next = graph.target(edge++);
+                    if (component[next] != -1 && !onStack[next]) continue;
+                    if (index[next] == -1) {
+                        discover(next);
+                    }
+                    else if (onStack[next]) {
+                        low[vertex] = std::min(low[vertex], index[next]);
+                    }
+                    continue;
+                }
+
+                // All edges explored: vertex roots a component if nothing on
+                // the stack below it is reachable from its subtree
+                if (low[vertex] == index[vertex]) {
+                    int member;
+                    do {
+                        member = sccStack.back();
+                        sccStack.pop_back();
+                        onStack[member] = 0;
+                        component[member] = count;
+                    } while (member != vertex);
+                    count++;
+                }
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    int parent = callStack.back().first;
+                    low[parent] = std::min(low[parent], low[vertex]);
+                }
+            }
+        }
+    }
+
+    // Calls visit(neighbor) for each out- (forward) or in-neighbor
+    template <typename Visit>
+    void forEachNeighbor(const CSRGraph& graph, int vertex, bool forward, Visit&& visit) {
+        if (forward) {
+            for (auto e = graph.edgeBegin(vertex), last = graph.edgeEnd(vertex); e < last; ++e) {
+                visit(graph.target(e));
+            }
+        }
+        else {
+            for (auto e = graph.inEdgeBegin(vertex), last = graph.inEdgeEnd(vertex); e < last; ++e) {
+                visit(graph.source(e));
+            }
+        }
+    }
+
+    // Collects the vertices accepted by select(vertex, thread) in parallel
+    template <typename Select>
+    std::vector<int> collect(int vertexCount, Select&& select) {
+        std::vector<std::vector<int>> found(ParallelExecutor::threadCount());
+        ParallelExecutor::forEachChunk(vertexCount, GRAIN, [&](size_t first, size_t last, unsigned thread) {
+            for (size_t v = first; v < last; v++) {
+                if (select(static_cast<int>(v))) found[thread].push_back(static_cast<int>(v));
+            }
+        });
+        std::vector<int> all;
+        for (const auto& part : found) {
+            all.insert(all.end(), part.begin(), part.end());
+        }
+        return all;
+    }
+
+    // Level-synchronous parallel search from source over unassigned
+    // vertices, setting bit in mark for everything it reaches
+    void markReachable(const CSRGraph& graph, const LabelArray& label, int source, bool forward,
+        std::unique_ptr<std::atomic<std::uint8_t>[]>& mark, std::uint8_t bit) {
+        const unsigned threads = ParallelExecutor::threadCount();
+        std::vector<std::vector<int>> discovered(threads);
+        std::vector<int> frontier(1, source);
+        mark[source].fetch_or(bit, std::memory_order_relaxed);
+
+        while (!frontier.empty()) {
+            ParallelExecutor::forEachChunk(frontier.size(), GRAIN / 16, [&](size_t first, size_t last, unsigned thread) {
+                for (size_t i = first; i < last; i++) {
+                    forEachNeighbor(graph, frontier[i], forward, [&](int next) {
+                        if (label[next].load(std::memory_order_relaxed) != -1) return;
+                        if (mark[next].load(std::memory_order_relaxed) & bit) return;
+                        if (!(mark[next].fetch_or(bit, std::memory_order_relaxed) & bit)) {
+                            discovered[thread].push_back(next);
+                        }
+                    });
+                }
+            });
+            frontier.clear();
+            for (auto& part : discovered) {
+                frontier.insert(frontier.end(), part.begin(), part.end());
+                part.clear();
+            }
+        }
+    }
+}
+
+StronglyConnectedComponents::Result StronglyConnectedComponents::run(const CSRGraph& graph) {
+    if (ParallelExecutor::threadCount() > 1 && graph.numVertices() >= PARALLEL_THRESHOLD) {
+        return forwardBackward(graph);
+    }
+    return tarjan(graph);
+}
+
+StronglyConnectedComponents::Result StronglyConnectedComponents::tarjan(const CSRGraph& graph) {
+    Result result;
+    result.component.assign(graph.numVertices(), -1);
+    tarjanRemaining(graph, result.component, result.count);
+    return result;
+}
+
+StronglyConnectedComponents::Result StronglyConnectedComponents::forwardBackward(const CSRGraph& graph) {
+    const int vertexCount = graph.numVertices();
+    Result result;
+    LabelArray label(new std::atomic<int>[vertexCount]);
+    ParallelExecutor::forEachChunk(vertexCount, GRAIN, [&](size_t first, size_t last, unsigned) {
+        for (size_t v = first; v < last; v++) {
+            label[v].store(-1, std::memory_order_relaxed);
+        }
+    });
+    std::atomic<int> nextId(0);
+    auto unassigned = [&](int v) { return label[v].load(std::memory_order_relaxed) == -1; };
+
+    // Trim: a vertex with no unassigned in- or out-neighbor is its own component
+    for (int round = 0; round < TRIM_ROUNDS; round++) {
+        std::vector<int> trimmed = collect(vertexCount, [&](int v) {
+            if (!unassigned(v)) return false;
+            bool hasIn = false;
+            bool hasOut = false;
+            forEachNeighbor(graph, v, true, [&](int w) { hasOut |= w != v && unassigned(w); });
+            if (!hasOut) return true;
+            forEachNeighbor(graph, v, false, [&](int w) { hasIn |= w != v && unassigned(w); });
+            return !hasIn;
+        });
+        for (int v : trimmed) {
+            label[v].store(nextId++, std::memory_order_relaxed);
+        }
+        if (trimmed.empty()) break;
+    }
+
+    // Forward-backward from the vertex most likely to be in the giant component
+    int pivot = -1;
+    long long bestScore = -1;
+    for (int v = 0; v < vertexCount; v++) {
+        if (!unassigned(v)) continue;
+        long long score = static_cast<long long>(graph.degree(v)) * graph.inDegree(v);
+        if (score > bestScore) {
+            bestScore = score;
+            pivot = v;
+        }
+    }
+    if (pivot >= 0) {
+        std::unique_ptr<std::atomic<std::uint8_t>[]> mark(new std::atomic<std::uint8_t>[vertexCount]);
+        ParallelExecutor::forEachChunk(vertexCount, GRAIN, [&](size_t first, size_t last, unsigned) {
+            for (size_t v = first; v < last; v++) {
+                mark[v].store(0, std::memory_order_relaxed);
+            }
+        });
+        markReachable(graph, label, pivot, true, mark, 1);
+        markReachable(graph, label, pivot, false, mark, 2);
+        const int giant = nextId++;
+        ParallelExecutor::forEachChunk(vertexCount, GRAIN, [&](size_t first, size_t last, unsigned) {
+            for (size_t v = first; v < last; v++) {
+                if (mark[v].load(std::memory_order_relaxed) == 3) label[v].store(giant, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    // Coloring: propagate the highest vertex ID along out-edges, so each
+    // color root's component is exactly the vertices of its color that
+    // reach it
+    std::unique_ptr<std::atomic<int>[]> color(new std::atomic<int>[vertexCount]);
+    std::vector<int> remaining = collect(vertexCount, unassigned);
+    while (remaining.size() >= static_cast<size_t>(SERIAL_THRESHOLD)) {
+        for (int v : remaining) {
+            color[v].store(v, std::memory_order_relaxed);
+        }
+        std::atomic<bool> changed(true);
+        while (changed.load()) {
+            changed = false;
+            ParallelExecutor::forEachChunk(remaining.size(), GRAIN, [&](size_t first, size_t last, unsigned) {
+                bool raised = false;
+                for (size_t i = first; i < last; i++) {
+                    const int v = remaining[i];
+                    const int c = color[v].load(std::memory_order_relaxed);
+                    forEachNeighbor(graph, v, true, [&](int w) {
+                        if (!unassigned(w)) return;
+                        int current = color[w].load(std::memory_order_relaxed);
+                        while (current < c) {
+                            if (color[w].compare_exchange_weak(current, c, std::memory_order_relaxed)) {
+                                raised = true;
+                                break;
+                            }
+                        }
+                    });
+                }
+                if (raised) changed = true;
+            });
+        }
+
+        std::vector<int> roots;
+        for (int v : remaining) {
+            if (color[v].load(std::memory_order_relaxed) == v) roots.push_back(v);
+        }
+        ParallelExecutor::forEachChunk(roots.size(), 1, [&](size_t first, size_t last, unsigned) {
+            std::vector<int> stack;
+            for (size_t i = first; i < last; i++) {
+                const int root = roots[i];
+                const int id = nextId++;
+                label[root].store(id, std::memory_order_relaxed);
+                stack.assign(1, root);
+                while (!stack.empty()) {
+                    const int v = stack.back();
+                    stack.pop_back();
+                    forEachNeighbor(graph, v, false, [&](int w) {
+                        if (!unassigned(w) || color[w].load(std::memory_order_relaxed) != root) return;
+                        label[w].store(id, std::memory_order_relaxed);
+                        stack.push_back(w);
+                    });
+                }
+            }
+        });
+
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+            [&](int v) { return !unassigned(v); }), remaining.end());
+    }
+
+    result.component.resize(vertexCount);
+    for (int v = 0; v < vertexCount; v++) {
+        result.component[v] = label[v].load(std::memory_order_relaxed);
+    }
+    result.count = nextId.load();
+    tarjanRemaining(graph, result.component, result.count);
+    return result;
+}
@@ -0,0 +1,40 @@
+// File: include/StronglyConnectedComponents.h
+#pragma once
+
+#include <vector>
+#include "CSRGraph.h"
+
+// Strongly connected components of a CSRGraph snapshot.
+class StronglyConnectedComponents {
+public:
+    // forwardBackward is used from this many vertices up when several
+    // workers are available
+    static constexpr int PARALLEL_THRESHOLD = 1 << 16;
+    // Trimming passes that peel off vertices without active in- or out-edges
+    static constexpr int TRIM_ROUNDS = 3;
+    // Coloring stops and Tarjan takes over below this many unassigned vertices
+    static constexpr int SERIAL_THRESHOLD = 1 << 14;
+
+    struct Result {
+        // Component of each dense vertex, numbered 0..count-1. tarjan()
+        // numbers them in reverse topological order of the condensation:
+        // every edge between two components goes from the higher ID to the
+        // lower one. Other methods give no ordering guarantee.
+        std::vector<int> component;
+        int count = 0;
+    };
+
+    // forwardBackward on large graphs with several workers, else tarjan
+    static Result run(const CSRGraph& graph);
+
+    // Tarjan's algorithm with an explicit call stack, so long chains cannot
+    // overflow the native stack
+    static Result tarjan(const CSRGraph& graph);
+
+    // Parallel Multistep-style decomposition (Slota et al.): trimming of
+    // trivial components, one forward-backward search from a high-degree
+    // pivot for the giant component, then rounds of max-color propagation
+    // with a backward search per color root. Whatever remains once it is
+    // small is finished by Tarjan.
+    static Result forwardBackward(const CSRGraph& graph);
+};
@@ -1,29 +1,35 @@
 // File: src/UnionFind.cpp
 #include "UnionFind.h"
+#include <utility>
 
-UnionFind::UnionFind(int n) : parent(n), rank(n, 0) {
-    for (int i = 0; i < n; i++) parent[i] = i;
+UnionFind::UnionFind(int n) : sets(0) {
+    grow(n);
 }
 
 int UnionFind::find(int x) {
-    if (parent[x] != x) {
-        parent[x] = find(parent[x]); // Path compression
+    // Path halving: point every other vertex on the path at its grandparent
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
     }
-    return parent[x];
+    return x;
 }
 
-void UnionFind::unite(int x, int y) {
+bool UnionFind::unite(int x, int y) {
     int px = find(x), py = find(y);
-    if (px == py) return;
+    if (px == py) return false;
 
-    if (rank[px] < rank[py]) {
-        parent[px] = py;
-    }
-    else if (rank[px] > rank[py]) {
-        parent[py] = px;
-    }
-    else {
-        parent[py] = px;
-        rank[px]++;
+    if (size[px] < size[py]) std::swap(px, py);
+    parent[py] = px;
+    size[px] += size[py];
+    sets--;
+    return true;
+}
+
+void UnionFind::grow(int n) {
+    for (int i = static_cast<int>(parent.size()); i < n; i++) {
+        parent.push_back(i);
+        size.push_back(1);
+        sets++;
     }
-}
\ No newline at end of file
+}
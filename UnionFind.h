@@ -3,13 +3,25 @@
 
 #include <vector>
 
+// Disjoint sets with union by size and path halving, so every operation is
+// O(alpha(n)) amortized. Elements can be appended at any time, which lets
+// the structure follow a growing graph.
 class UnionFind {
 private:
     std::vector<int> parent;
-    std::vector<int> rank;
+    std::vector<int> size;
+    int sets;
 
 public:
-    explicit UnionFind(int n);
+    explicit UnionFind(int n = 0);
     int find(int x);
-    void unite(int x, int y);
-};
\ No newline at end of file
+    // Returns true if x and y were in different sets
+    bool unite(int x, int y);
+
+    // Appends singleton sets until there are n elements
+    void grow(int n);
+    bool connected(int x, int y) { return find(x) == find(y); }
+    int setSize(int x) { return size[find(x)]; }
+    int setCount() const { return sets; }
+    int elementCount() const { return static_cast<int>(parent.size()); }
+};
@@ -0,0 +1,20 @@
+// File: src/VertexIdMap.cpp
+#include "VertexIdMap.h"
+
+int VertexIdMap::insert(NodeId id) {
+    auto [it, inserted] = denseIndex.try_emplace(id, static_cast<int>(externalIds.size()));
+    if (inserted) {
+        externalIds.push_back(id);
+    }
+    return it->second;
+}
+
+int VertexIdMap::toDense(NodeId id) const {
+    auto it = denseIndex.find(id);
+    return it == denseIndex.end() ? -1 : it->second;
+}
+
+void VertexIdMap::reserve(std::size_t count) {
+    denseIndex.reserve(count);
+    externalIds.reserve(count);
+}
@@ -0,0 +1,32 @@
+// File: include/VertexIdMap.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// External node identifiers as supplied by callers (may be sparse or 64-bit)
+using NodeId = std::int64_t;
+
+// Bidirectional mapping between external node IDs and dense internal indices
+// 0..size()-1. Dense indices are assigned in insertion order and never change,
+// so every per-vertex array can be sized to the actual vertex count.
+class VertexIdMap {
+private:
+    std::unordered_map<NodeId, int> denseIndex;
+    std::vector<NodeId> externalIds;
+
+public:
+    // Returns the dense index of id, assigning the next free one if it is new
+    int insert(NodeId id);
+    // Returns the dense index of id, or -1 if it has not been inserted
+    int toDense(NodeId id) const;
+    NodeId toExternal(int index) const { return externalIds[index]; }
+
+    bool contains(NodeId id) const { return denseIndex.find(id) != denseIndex.end(); }
+    int size() const { return static_cast<int>(externalIds.size()); }
+    void reserve(std::size_t count);
+
+    const std::vector<NodeId>& getExternalIds() const { return externalIds; }
+};
@@ -101,6 +101,7 @@ int main() {
 
     visOptions.layout = GraphVisualizer::Layout::FORCE;
     visOptions.colorScheme = GraphVisualizer::ColorScheme::COMMUNITY;
+    visOptions.communities = smallWorldGraph.louvainCommunities().community;
     GraphVisualizer::exportToDOT(smallWorldGraph, "small_world_graph.dot", visOptions);
     GraphVisualizer::exportToHTML(smallWorldGraph, "small_world_graph.html", visOptions);
 
@@ -395,6 +396,7 @@ int main() {
 
     visOptions.layout = GraphVisualizer::Layout::FORCE;
     visOptions.colorScheme = GraphVisualizer::ColorScheme::COMMUNITY;
+    visOptions.communities = communityGraph.louvainCommunities().community;
 
     GraphVisualizer::exportToHTML(communityGraph, "visualizations/community_graph.html", visOptions);
     printSeparator();
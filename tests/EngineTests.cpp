@@ -0,0 +1,1014 @@
+// File: tests/EngineTests.cpp
+// Checks the algorithm engines against plain reference implementations on
+// seeded random graphs. Prints one line per test and exits with a non-zero
+// status if any check fails.
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ContractionHierarchy.h"
+#include "EdgeListLoader.h"
+#include "GraphAnalysisTool.h"
+#include "ParallelExecutor.h"
+
+namespace {
+    const int INF = INT_MAX;
+
+    int failures = 0;
+    int testFailures = 0;
+
+    void check(bool condition, const char* expression, int line) {
+        if (condition) return;
+        if (testFailures < 5) {
+            std::cout << "    line " << line << ": " << expression << "\n";
+        }
+        testFailures++;
+    }
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+    // Sparse, non-contiguous external IDs exercise the dense ID mapping
+    NodeId externalId(int v) {
+        return static_cast<NodeId>(v) * 7919 + 13;
+    }
+
+    int localIndex(NodeId id) {
+        return static_cast<int>((id - 13) / 7919);
+    }
+
+    // The same graph as a GraphAnalysisTool and as a plain adjacency list
+    // over local indices 0..n-1. Every vertex is added first, so dense order
+    // matches local order.
+    struct TestGraph {
+        int n = 0;
+        std::vector<std::vector<std::pair<int, int>>> out;
+        GraphAnalysisTool tool;
+
+        explicit TestGraph(int vertexCount) : n(vertexCount), out(vertexCount) {
+            for (int v = 0; v < n; v++) tool.addNode(externalId(v));
+        }
+
+        void addEdge(int from, int to, int weight) {
+            out[from].push_back({ to, weight });
+            tool.addEdge(externalId(from), externalId(to), weight);
+        }
+        // Lightest from -> to edge, INF if there is none
+        int edgeWeight(int from, int to) const {
+            int best = INF;
+            for (const auto& [target, weight] : out[from]) {
+                if (target == to) best = std::min(best, weight);
+            }
+            return best;
+        }
+    };
+
+    TestGraph randomGraph(std::mt19937& rng, int n, int m, int minWeight, int maxWeight) {
+        TestGraph graph(n);
+        std::uniform_int_distribution<int> vertex(0, n - 1);
+        std::uniform_int_distribution<int> weight(minWeight, maxWeight);
+        for (int i = 0; i < m; i++) {
+            graph.addEdge(vertex(rng), vertex(rng), weight(rng));
+        }
+        return graph;
+    }
+
+    // Rewrites filename with its bytes changed by edit
+    void editFile(const std::string& filename, const std::function<void(std::string&)>& edit) {
+        std::ifstream in(filename, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        edit(bytes);
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out << bytes;
+    }
+
+    // Overwrites one int of filename at the position chosen from its bytes
+    void corruptFile(const std::string& filename, const std::function<size_t(const std::string&)>& position) {
+        editFile(filename, [&](std::string& bytes) {
+            const size_t at = position(bytes);
+            for (size_t i = 0; i < 4; i++) bytes[at + i] = '\x7f';
+        });
+    }
+
+    bool throwsRuntimeError(const std::function<void()>& action) {
+        try {
+            action();
+        }
+        catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    std::vector<int> referenceDijkstra(const TestGraph& graph, int source) {
+        std::vector<long long> distance(graph.n, LLONG_MAX);
+        using Entry = std::pair<long long, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        distance[source] = 0;
+        queue.push({ 0, source });
+        while (!queue.empty()) {
+            auto [d, v] = queue.top();
+            queue.pop();
+            if (d > distance[v]) continue;
+            for (const auto& [target, weight] : graph.out[v]) {
+                if (d + weight < distance[target]) {
+                    distance[target] = d + weight;
+                    queue.push({ distance[target], target });
+                }
+            }
+        }
+        std::vector<int> result(graph.n);
+        for (int v = 0; v < graph.n; v++) {
+            result[v] = distance[v] == LLONG_MAX ? INF : static_cast<int>(distance[v]);
+        }
+        return result;
+    }
+
+    // Distances from source, or an empty vector if a negative cycle is reachable
+    std::vector<int> referenceBellmanFord(const TestGraph& graph, int source) {
+        std::vector<long long> distance(graph.n, LLONG_MAX);
+        distance[source] = 0;
+        for (int round = 0; round <= graph.n; round++) {
+            bool changed = false;
+            for (int v = 0; v < graph.n; v++) {
+                if (distance[v] == LLONG_MAX) continue;
+                for (const auto& [target, weight] : graph.out[v]) {
+                    if (distance[v] + weight < distance[target]) {
+                        distance[target] = distance[v] + weight;
+                        changed = true;
+                    }
+                }
+            }
+            if (!changed) break;
+            if (round == graph.n) return {};
+        }
+        std::vector<int> result(graph.n);
+        for (int v = 0; v < graph.n; v++) {
+            result[v] = distance[v] == LLONG_MAX ? INF : static_cast<int>(distance[v]);
+        }
+        return result;
+    }
+
+    std::vector<int> referenceBFS(const TestGraph& graph, int source) {
+        std::vector<int> depth(graph.n, -1);
+        std::queue<int> queue;
+        depth[source] = 0;
+        queue.push(source);
+        while (!queue.empty()) {
+            int v = queue.front();
+            queue.pop();
+            for (const auto& edge : graph.out[v]) {
+                if (depth[edge.first] < 0) {
+                    depth[edge.first] = depth[v] + 1;
+                    queue.push(edge.first);
+                }
+            }
+        }
+        return depth;
+    }
+
+    // Weak components by undirected BFS; component IDs are arbitrary
+    std::vector<int> referenceWeakComponents(const TestGraph& graph, int& count) {
+        std::vector<std::vector<int>> undirected(graph.n);
+        for (int v = 0; v < graph.n; v++) {
+            for (const auto& edge : graph.out[v]) {
+                undirected[v].push_back(edge.first);
+                undirected[edge.first].push_back(v);
+            }
+        }
+        std::vector<int> component(graph.n, -1);
+        count = 0;
+        for (int root = 0; root < graph.n; root++) {
+            if (component[root] >= 0) continue;
+            std::vector<int> stack = { root };
+            component[root] = count;
+            while (!stack.empty()) {
+                int v = stack.back();
+                stack.pop_back();
+                for (int w : undirected[v]) {
+                    if (component[w] < 0) {
+                        component[w] = count;
+                        stack.push_back(w);
+                    }
+                }
+            }
+            count++;
+        }
+        return component;
+    }
+
+    // Two labelings describe the same partition
+    bool samePartition(const std::vector<int>& a, const std::vector<int>& b) {
+        if (a.size() != b.size()) return false;
+        std::vector<std::pair<int, int>> pairs;
+        for (size_t i = 0; i < a.size(); i++) pairs.push_back({ a[i], b[i] });
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        std::set<int> left, right;
+        for (const auto& [x, y] : pairs) {
+            left.insert(x);
+            right.insert(y);
+        }
+        return pairs.size() == left.size() && pairs.size() == right.size();
+    }
+
+    // Iterative Kosaraju; component IDs are arbitrary
+    std::vector<int> referenceSCC(const TestGraph& graph) {
+        std::vector<std::vector<int>> in(graph.n);
+        for (int v = 0; v < graph.n; v++) {
+            for (const auto& edge : graph.out[v]) in[edge.first].push_back(v);
+        }
+        std::vector<int> order;
+        std::vector<char> visited(graph.n, 0);
+        for (int root = 0; root < graph.n; root++) {
+            if (visited[root]) continue;
+            std::vector<std::pair<int, size_t>> stack = { { root, 0 } };
+            visited[root] = 1;
+            while (!stack.empty()) {
+                auto& [v, next] = stack.back();
+                if (next < graph.out[v].size()) {
+                    int w = graph.out[v][next++].first;
+                    if (!visited[w]) {
+                        visited[w] = 1;
+                        stack.push_back({ w, 0 });
+                    }
+                }
+                else {
+                    order.push_back(v);
+                    stack.pop_back();
+                }
+            }
+        }
+        std::vector<int> component(graph.n, -1);
+        int count = 0;
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            if (component[*it] >= 0) continue;
+            std::vector<int> stack = { *it };
+            component[*it] = count;
+            while (!stack.empty()) {
+                int v = stack.back();
+                stack.pop_back();
+                for (int u : in[v]) {
+                    if (component[u] < 0) {
+                        component[u] = count;
+                        stack.push_back(u);
+                    }
+                }
+            }
+            count++;
+        }
+        return component;
+    }
+
+    // The path starts at from, ends at to, follows existing edges and its
+    // lightest edges add up to distance
+    bool validPath(const TestGraph& graph, const std::vector<NodeId>& path, int from, int to, int distance) {
+        if (distance == INF) return path.empty();
+        if (path.empty() || path.front() != externalId(from) || path.back() != externalId(to)) return false;
+        long long total = 0;
+        for (size_t i = 0; i + 1 < path.size(); i++) {
+            int weight = graph.edgeWeight(localIndex(path[i]), localIndex(path[i + 1]));
+            if (weight == INF) return false;
+            total += weight;
+        }
+        return total == distance;
+    }
+
+    // Random point-to-point queries with one algorithm against reference Dijkstra
+    void checkShortestPaths(GraphAnalysisTool::PathAlgorithm algorithm, unsigned seed,
+        int minWeight, int maxWeight) {
+        std::mt19937 rng(seed);
+        TestGraph graph = randomGraph(rng, 400, 1800, minWeight, maxWeight);
+        for (int q = 0; q < 60; q++) {
+            int from = static_cast<int>(rng() % graph.n);
+            int to = static_cast<int>(rng() % graph.n);
+            auto [path, distance] = graph.tool.shortestPath(externalId(from), externalId(to), algorithm);
+            CHECK(distance == referenceDijkstra(graph, from)[to]);
+            CHECK(validPath(graph, path, from, to, distance));
+        }
+        CHECK(graph.tool.shortestPath(externalId(0), 5, algorithm).second == INF);
+        CHECK(graph.tool.shortestPath(5, externalId(0), algorithm).second == INF);
+    }
+
+    void testCsrSnapshot() {
+        std::mt19937 rng(1);
+        TestGraph graph = randomGraph(rng, 200, 600, -5, 9);
+        auto snapshot = graph.tool.freeze();
+        CHECK(snapshot->numVertices() == graph.n);
+        CHECK(static_cast<int>(snapshot->numEdges()) == graph.tool.getNumEdges());
+
+        int lowest = 9;
+        int highest = -5;
+        for (int v = 0; v < graph.n; v++) {
+            std::multiset<std::pair<int, int>> expected(graph.out[v].begin(), graph.out[v].end());
+            std::multiset<std::pair<int, int>> actual;
+            for (auto e = snapshot->edgeBegin(v); e < snapshot->edgeEnd(v); ++e) {
+                actual.insert({ snapshot->target(e), snapshot->weight(e) });
+            }
+            CHECK(expected == actual);
+            for (const auto& edge : graph.out[v]) {
+                lowest = std::min(lowest, edge.second);
+                highest = std::max(highest, edge.second);
+            }
+        }
+        CHECK(snapshot->minWeight() == lowest && snapshot->maxWeight() == highest);
+
+        // Unchanged graphs share the snapshot; mutations leave old ones intact
+        CHECK(graph.tool.freeze() == snapshot);
+        graph.addEdge(0, 1, 3);
+        auto rebuilt = graph.tool.freeze();
+        CHECK(rebuilt != snapshot);
+        CHECK(rebuilt->numEdges() == snapshot->numEdges() + 1);
+    }
+
+    void testIdMapping() {
+        std::mt19937 rng(2);
+        TestGraph graph = randomGraph(rng, 200, 600, 1, 9);
+        const std::vector<NodeId>& nodes = graph.tool.getNodes();
+        CHECK(static_cast<int>(nodes.size()) == graph.n);
+        auto snapshot = graph.tool.freeze();
+        for (int v = 0; v < graph.n; v++) {
+            CHECK(nodes[v] == externalId(v));
+            CHECK(graph.tool.getIdMap().toDense(externalId(v)) == v);
+            CHECK(snapshot->toDense(externalId(v)) == v && snapshot->toExternal(v) == externalId(v));
+        }
+        CHECK(graph.tool.getIdMap().toDense(4) == -1);
+        CHECK(snapshot->toDense(4) == -1);
+
+        // 64-bit IDs far outside the int range map like any other
+        GraphAnalysisTool wide;
+        const NodeId big = static_cast<NodeId>(1) << 40;
+        wide.addEdge(big, -big, 2);
+        CHECK(wide.getNumNodes() == 2);
+        CHECK(wide.shortestPath(big, -big).second == 2);
+    }
+
+    void testReverseAdjacency() {
+        std::mt19937 rng(3);
+        TestGraph graph = randomGraph(rng, 300, 250, 1, 9);
+        std::vector<std::multiset<std::pair<int, int>>> expected(graph.n);
+        for (int v = 0; v < graph.n; v++) {
+            for (const auto& [target, weight] : graph.out[v]) expected[target].insert({ v, weight });
+        }
+        const auto& reverse = graph.tool.getReverseAdjacencyList();
+        std::vector<NodeId> isolated;
+        for (int v = 0; v < graph.n; v++) {
+            std::multiset<std::pair<int, int>> actual(reverse[v].begin(), reverse[v].end());
+            CHECK(actual == expected[v]);
+            bool alone = graph.out[v].empty() && expected[v].empty();
+            CHECK(graph.tool.isNodeIsolated(externalId(v)) == alone);
+            if (alone) isolated.push_back(externalId(v));
+        }
+        CHECK(graph.tool.getIsolatedNodes() == isolated);
+        CHECK(graph.tool.isNodeIsolated(5));
+    }
+
+    void testBulkIngestion() {
+        std::mt19937 rng(4);
+        std::vector<GraphAnalysisTool::Edge> edges;
+        for (int i = 0; i < 20000; i++) {
+            edges.push_back({ static_cast<NodeId>(rng() % 3000) * 31, static_cast<NodeId>(rng() % 3000) * 31,
+                static_cast<int>(rng() % 50) });
+        }
+        GraphAnalysisTool single;
+        for (const auto& edge : edges) single.addEdge(edge.from, edge.to, edge.weight);
+        GraphAnalysisTool bulk;
+        bulk.addEdge(edges[0].from, edges[0].to, edges[0].weight);
+        bulk.addEdges(edges.data() + 1, edges.size() - 1);
+
+        CHECK(bulk.getNodes() == single.getNodes());
+        CHECK(bulk.getNumEdges() == single.getNumEdges());
+        CHECK(bulk.getAdjacencyList() == single.getAdjacencyList());
+        CHECK(bulk.getReverseAdjacencyList() == single.getReverseAdjacencyList());
+    }
+
+    void testBinaryPersistence() {
+        std::mt19937 rng(5);
+        TestGraph graph = randomGraph(rng, 800, 3200, 1, 40);
+        const std::string graphFile = "engine_tests_graph.bin";
+        graph.tool.saveBinary(graphFile);
+
+        GraphAnalysisTool loaded = GraphAnalysisTool::loadBinary(graphFile);
+        CHECK(loaded.getNumNodes() == graph.n);
+        CHECK(loaded.getNumEdges() == graph.tool.getNumEdges());
+        for (int q = 0; q < 40; q++) {
+            int from = static_cast<int>(rng() % graph.n);
+            int to = static_cast<int>(rng() % graph.n);
+            CHECK(loaded.shortestPath(externalId(from), externalId(to)) ==
+                graph.tool.shortestPath(externalId(from), externalId(to)));
+        }
+        CHECK(loaded.getNodes() == graph.tool.getNodes());
+
+        // An edge count whose byte size wraps around 64 bits, with offsets
+        // that agree with it, must not pass the section size checks. The
+        // edge count is at byte 24 and the section table starts at byte 40;
+        // entries 0 and 3 locate the forward and reverse offsets.
+        editFile(graphFile, [&](std::string& bytes) {
+            std::uint64_t edges = 0;
+            std::memcpy(&edges, bytes.data() + 24, sizeof(edges));
+            edges += std::uint64_t(1) << 62;
+            std::memcpy(&bytes[24], &edges, sizeof(edges));
+            for (size_t entry : { 0, 3 }) {
+                std::uint64_t offsets = 0;
+                std::memcpy(&offsets, bytes.data() + 40 + 8 * entry, sizeof(offsets));
+                std::memcpy(&bytes[offsets + 8 * graph.n], &edges, sizeof(edges));
+            }
+        });
+        CHECK(throwsRuntimeError([&] { GraphAnalysisTool::loadBinary(graphFile); }));
+        graph.tool.saveBinary(graphFile);
+
+        // An out-of-range edge target must be rejected when the file is
+        // opened, not read out of bounds later. Entry 1 of the section table
+        // locates the targets.
+        corruptFile(graphFile, [](const std::string& bytes) {
+            std::uint64_t targets = 0;
+            std::memcpy(&targets, bytes.data() + 48, sizeof(targets));
+            return static_cast<size_t>(targets) + 4 * 100;
+        });
+        CHECK(throwsRuntimeError([&] { GraphAnalysisTool::loadBinary(graphFile); }));
+        CHECK(throwsRuntimeError([&] { GraphAnalysisTool::loadBinary("engine_tests_missing.bin"); }));
+        std::remove(graphFile.c_str());
+    }
+
+    void testEdgeListLoader() {
+        const std::string text =
+            "# comment\n"
+            "1 2 5\n"
+            "2,3\n"
+            "3\t4\t2.6\n"
+            "4 5 99999999999\n"
+            "5 6 1e300\n"
+            "not an edge\n"
+            "// another comment\n";
+        EdgeListLoader::Options options;
+        options.defaultWeight = 7;
+        EdgeListLoader::ParseResult parsed = EdgeListLoader::parseBuffer(text.data(), text.size(), options);
+        CHECK(parsed.edges.size() == 3);
+        // Comments count as skipped lines too
+        CHECK(parsed.linesSkipped == 5);
+        if (parsed.edges.size() == 3) {
+            CHECK(parsed.edges[0].from == 1 && parsed.edges[0].to == 2 && parsed.edges[0].weight == 5);
+            CHECK(parsed.edges[1].weight == 7);
+            CHECK(parsed.edges[2].weight == 3);
+        }
+
+        const std::string matrixMarket =
+            "%%MatrixMarket matrix coordinate real symmetric\n"
+            "% comment\n"
+            "3 3 2\n"
+            "1 2 1.5\n"
+            "2 3 4\n";
+        parsed = EdgeListLoader::parseBuffer(matrixMarket.data(), matrixMarket.size(), EdgeListLoader::Options());
+        CHECK(parsed.edges.size() == 4);
+
+        // The symmetry field decides the mirrored entry: negated for
+        // skew-symmetric, the same real part for hermitian, none for general
+        auto parseMatrix = [](const std::string& symmetry) {
+            const std::string matrix =
+                "%%MatrixMarket matrix coordinate complex " + symmetry + "\n"
+                "3 3 2\n"
+                "1 2 1.5 -2\n"
+                "3 3 4 0\n";
+            return EdgeListLoader::parseBuffer(matrix.data(), matrix.size(), EdgeListLoader::Options()).edges;
+        };
+        using Edges = std::vector<GraphAnalysisTool::Edge>;
+        auto sameEdges = [](const Edges& a, const Edges& b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+                [](const GraphAnalysisTool::Edge& x, const GraphAnalysisTool::Edge& y) {
+                    return x.from == y.from && x.to == y.to && x.weight == y.weight;
+                });
+        };
+        CHECK(sameEdges(parseMatrix("skew-symmetric"), Edges{ { 1, 2, 2 }, { 2, 1, -2 }, { 3, 3, 4 } }));
+        CHECK(sameEdges(parseMatrix("Hermitian"), Edges{ { 1, 2, 2 }, { 2, 1, 2 }, { 3, 3, 4 } }));
+        CHECK(sameEdges(parseMatrix("general"), Edges{ { 1, 2, 2 }, { 3, 3, 4 } }));
+        CHECK(throwsRuntimeError([&] { parseMatrix("antisymmetric"); }));
+    }
+
+    // Negative weights against Bellman-Ford, first without cycles (every edge
+    // points to a higher index), then with a negative cycle through 50 and 51
+    // that leaves everything it reaches without a shortest path
+    void checkNegativeWeights(GraphAnalysisTool::PathAlgorithm algorithm, unsigned seed) {
+        std::mt19937 rng(seed);
+        TestGraph dag(300);
+        for (int i = 0; i < 1200; i++) {
+            int a = static_cast<int>(rng() % dag.n);
+            int b = static_cast<int>(rng() % dag.n);
+            if (a != b) dag.addEdge(std::min(a, b), std::max(a, b), static_cast<int>(rng() % 41) - 20);
+        }
+        for (int q = 0; q < 40; q++) {
+            int from = static_cast<int>(rng() % dag.n);
+            int to = static_cast<int>(rng() % dag.n);
+            auto [path, distance] = dag.tool.shortestPath(externalId(from), externalId(to), algorithm);
+            CHECK(distance == referenceBellmanFord(dag, from)[to]);
+            CHECK(validPath(dag, path, from, to, distance));
+        }
+
+        dag.addEdge(0, 50, 0);
+        dag.addEdge(50, 51, 1);
+        std::vector<int> fromStart = referenceBellmanFord(dag, 0);
+        std::vector<int> fromCycle = referenceBellmanFord(dag, 50);
+        dag.addEdge(51, 50, -3);
+        for (int to = 0; to < dag.n; to++) {
+            auto [path, distance] = dag.tool.shortestPath(externalId(0), externalId(to), algorithm);
+            if (fromCycle[to] != INF) {
+                CHECK(distance == INT_MIN && path.empty());
+            }
+            else {
+                CHECK(distance == fromStart[to]);
+                CHECK(validPath(dag, path, 0, to, distance));
+            }
+        }
+    }
+
+    void testDijkstra() {
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::DIJKSTRA, 7, 1, 1000);
+        checkNegativeWeights(GraphAnalysisTool::PathAlgorithm::DIJKSTRA, 70);
+    }
+
+    void testBidirectional() {
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::BIDIRECTIONAL, 8, 1, 1000);
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::BIDIRECTIONAL, 80, 0, 3);
+        checkNegativeWeights(GraphAnalysisTool::PathAlgorithm::BIDIRECTIONAL, 81);
+    }
+
+    void testALT() {
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::ALT, 9, 1, 1000);
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::ALT, 90, 0, 3);
+        checkNegativeWeights(GraphAnalysisTool::PathAlgorithm::ALT, 91);
+    }
+
+    void testContractionHierarchy() {
+        using Algorithm = GraphAnalysisTool::PathAlgorithm;
+        checkShortestPaths(Algorithm::CONTRACTION_HIERARCHY, 10, 1, 1000);
+        checkShortestPaths(Algorithm::CONTRACTION_HIERARCHY, 100, 0, 3);
+        checkNegativeWeights(Algorithm::CONTRACTION_HIERARCHY, 102);
+
+        // Standalone query object, and a saved index attached to a copy
+        std::mt19937 rng(101);
+        TestGraph graph = randomGraph(rng, 600, 2400, 1, 40);
+        HierarchyQuery query = graph.tool.createHierarchyQuery();
+        const std::string hierarchyFile = "engine_tests_hierarchy.bin";
+        graph.tool.saveContractionHierarchy(hierarchyFile);
+        GraphAnalysisTool loaded = graph.tool;
+        loaded.loadContractionHierarchy(hierarchyFile);
+        for (int q = 0; q < 40; q++) {
+            int from = static_cast<int>(rng() % graph.n);
+            int to = static_cast<int>(rng() % graph.n);
+            int expected = referenceDijkstra(graph, from)[to];
+            auto [path, distance] = query.shortestPath(externalId(from), externalId(to));
+            CHECK(distance == expected);
+            CHECK(validPath(graph, path, from, to, distance));
+            auto [loadedPath, loadedDistance] = loaded.shortestPath(externalId(from), externalId(to),
+                Algorithm::CONTRACTION_HIERARCHY);
+            CHECK(loadedDistance == expected);
+            CHECK(validPath(graph, loadedPath, from, to, loadedDistance));
+        }
+
+        // An arc count raised by 2^62 gives the same byte size modulo 2^64;
+        // the up arc count is at byte 32
+        editFile(hierarchyFile, [](std::string& bytes) {
+            std::uint64_t upCount = 0;
+            std::memcpy(&upCount, bytes.data() + 32, sizeof(upCount));
+            upCount += std::uint64_t(1) << 62;
+            std::memcpy(&bytes[32], &upCount, sizeof(upCount));
+        });
+        CHECK(throwsRuntimeError([&] { loaded.loadContractionHierarchy(hierarchyFile); }));
+        graph.tool.saveContractionHierarchy(hierarchyFile);
+
+        // The last int is the final shortcut middle vertex
+        corruptFile(hierarchyFile, [](const std::string& bytes) { return bytes.size() - 4; });
+        CHECK(throwsRuntimeError([&] { loaded.loadContractionHierarchy(hierarchyFile); }));
+        std::remove(hierarchyFile.c_str());
+
+        // Standalone queries fall back to the plain search too
+        graph.addEdge(0, 1, -30);
+        graph.addEdge(1, 0, 10);
+        HierarchyQuery negativeQuery = graph.tool.createHierarchyQuery();
+        for (int q = 0; q < 20; q++) {
+            NodeId from = externalId(static_cast<int>(rng() % graph.n));
+            NodeId to = externalId(static_cast<int>(rng() % graph.n));
+            CHECK(negativeQuery.shortestPath(from, to) == graph.tool.shortestPath(from, to));
+        }
+    }
+
+    void testDeltaStepping() {
+        std::mt19937 rng(11);
+        TestGraph graph = randomGraph(rng, 3000, 12000, 0, 500);
+        for (int source : { 0, 17, 2999 }) {
+            std::vector<int> expected = referenceDijkstra(graph, source);
+            for (int delta : { 0, 1, 7, 100000 }) {
+                CHECK(graph.tool.shortestDistances(externalId(source), delta) == expected);
+            }
+        }
+        graph.addEdge(1, 2, -1);
+        CHECK(graph.tool.shortestDistances(externalId(0)).empty());
+    }
+
+    void testSmallIntegerWeights() {
+        // Dial buckets for small weights, 0-1 BFS for weights 0 and 1
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::DIJKSTRA, 12, 1, 12);
+        checkShortestPaths(GraphAnalysisTool::PathAlgorithm::DIJKSTRA, 120, 0, 1);
+    }
+
+    void testDistanceMatrix() {
+        std::mt19937 rng(13);
+        TestGraph graph = randomGraph(rng, 500, 2000, 1, 50);
+        std::vector<NodeId> sources, targets;
+        for (int i = 0; i < 20; i++) sources.push_back(externalId(static_cast<int>(rng() % graph.n)));
+        for (int i = 0; i < 30; i++) targets.push_back(externalId(static_cast<int>(rng() % graph.n)));
+        sources.push_back(5);
+        targets.push_back(5);
+
+        GraphAnalysisTool::DistanceMatrix matrix = graph.tool.distanceMatrix(sources, targets);
+        CHECK(matrix.rows == sources.size() && matrix.columns == targets.size());
+        for (size_t i = 0; i + 1 < sources.size(); i++) {
+            std::vector<int> expected = referenceDijkstra(graph, localIndex(sources[i]));
+            for (size_t j = 0; j + 1 < targets.size(); j++) {
+                CHECK(matrix.at(i, j) == expected[localIndex(targets[j])]);
+            }
+            CHECK(matrix.at(i, targets.size() - 1) == INF);
+        }
+    }
+
+    void testAllPairs() {
+        using Method = GraphAnalysisTool::AllPairsMethod;
+        std::mt19937 rng(14);
+        TestGraph graph = randomGraph(rng, 150, 700, 1, 30);
+        for (Method method : { Method::FLOYD_WARSHALL, Method::REPEATED_DIJKSTRA }) {
+            GraphAnalysisTool::DistanceMatrix matrix = graph.tool.allPairsShortestPaths(method);
+            CHECK(!matrix.negativeCycle);
+            for (int s = 0; s < graph.n; s++) {
+                std::vector<int> expected = referenceDijkstra(graph, s);
+                for (int t = 0; t < graph.n; t++) CHECK(matrix.at(s, t) == expected[t]);
+            }
+        }
+
+        // Negative weights on a DAG: no cycles, many unreachable pairs
+        TestGraph dag(130);
+        for (int i = 0; i < 500; i++) {
+            int a = static_cast<int>(rng() % dag.n);
+            int b = static_cast<int>(rng() % dag.n);
+            if (a == b) continue;
+            dag.addEdge(std::min(a, b), std::max(a, b), static_cast<int>(rng() % 41) - 20);
+        }
+        GraphAnalysisTool::DistanceMatrix matrix = dag.tool.allPairsShortestPaths();
+        CHECK(!matrix.negativeCycle);
+        for (int s = 0; s < dag.n; s++) {
+            std::vector<int> expected = referenceBellmanFord(dag, s);
+            for (int t = 0; t < dag.n; t++) CHECK(matrix.at(s, t) == expected[t]);
+        }
+
+        dag.addEdge(dag.n - 1, 0, -100000);
+        dag.addEdge(0, dag.n - 1, -100000);
+        CHECK(dag.tool.allPairsShortestPaths(Method::REPEATED_DIJKSTRA).negativeCycle);
+    }
+
+    void testPathCache() {
+        // Cached trees must agree with fresh searches across mutations
+        std::mt19937 rng(15);
+        TestGraph graph = randomGraph(rng, 300, 900, 1, 20);
+        graph.tool.enablePathCache(4);
+        for (int round = 0; round < 5; round++) {
+            for (int q = 0; q < 40; q++) {
+                int source = static_cast<int>(rng() % 6);
+                int to = static_cast<int>(rng() % graph.n);
+                auto [path, distance] = graph.tool.shortestPath(externalId(source), externalId(to));
+                CHECK(distance == referenceDijkstra(graph, source)[to]);
+                CHECK(validPath(graph, path, source, to, distance));
+            }
+            graph.addEdge(static_cast<int>(rng() % graph.n), static_cast<int>(rng() % graph.n), 1);
+        }
+    }
+
+    void testDynamicShortestPaths() {
+        std::mt19937 rng(16);
+        TestGraph graph = randomGraph(rng, 600, 1200, 5, 100);
+        graph.tool.trackSource(externalId(0));
+        graph.tool.trackSource(externalId(1));
+
+        for (int round = 0; round < 15; round++) {
+            std::vector<GraphAnalysisTool::Edge> batch;
+            for (int i = 0; i < 40; i++) {
+                int from = static_cast<int>(rng() % graph.n);
+                int to = static_cast<int>(rng() % graph.n);
+                int weight = static_cast<int>(rng() % 100) + 1;
+                if (i % 2 == 0) {
+                    graph.addEdge(from, to, weight);
+                }
+                else {
+                    graph.out[from].push_back({ to, weight });
+                    batch.push_back({ externalId(from), externalId(to), weight });
+                }
+            }
+            graph.tool.addEdges(batch);
+
+            // decreaseEdgeWeight lowers the first matching edge heavier than
+            // the new weight, if there is one
+            int from = static_cast<int>(rng() % graph.n);
+            int to = static_cast<int>(rng() % graph.n);
+            int lowered = static_cast<int>(rng() % 30);
+            bool found = false;
+            for (auto& edge : graph.out[from]) {
+                if (edge.first == to && edge.second > lowered) {
+                    edge.second = lowered;
+                    found = true;
+                    break;
+                }
+            }
+            CHECK(graph.tool.decreaseEdgeWeight(externalId(from), externalId(to), lowered) == found);
+            if (!graph.out[from].empty()) {
+                to = graph.out[from].front().first;
+                lowered = graph.out[from].front().second / 2;
+                graph.out[from].front().second = lowered;
+                CHECK(graph.tool.decreaseEdgeWeight(externalId(from), externalId(to), lowered));
+            }
+
+            for (int source : { 0, 1 }) {
+                std::vector<int> expected = referenceDijkstra(graph, source);
+                for (int q = 0; q < 30; q++) {
+                    int to = static_cast<int>(rng() % graph.n);
+                    auto [path, distance] = graph.tool.shortestPath(externalId(source), externalId(to));
+                    CHECK(distance == expected[to]);
+                    CHECK(validPath(graph, path, source, to, distance));
+                }
+            }
+        }
+
+        // A negative weight ends tracking, and trackSource ignores graphs
+        // that have one; queries then search the current graph
+        graph.addEdge(2, 3, -4);
+        graph.tool.trackSource(externalId(2));
+        graph.addEdge(3, 4, 1);
+        graph.addEdge(4, 2, 3);
+        for (int source : { 0, 2 }) {
+            auto [path, distance] = graph.tool.shortestPath(externalId(source), externalId(3));
+            CHECK(distance == referenceBellmanFord(graph, source)[3]);
+            CHECK(validPath(graph, path, source, 3, distance));
+        }
+        // 2 -> 3 -> 4 -> 2 becomes a negative cycle
+        graph.tool.trackSource(externalId(0));
+        CHECK(graph.tool.decreaseEdgeWeight(externalId(4), externalId(2), -1));
+        CHECK(graph.tool.shortestPath(externalId(2), externalId(3)).second == INT_MIN);
+    }
+
+    void testBreadthFirstSearch() {
+        std::mt19937 rng(17);
+        // Dense enough that the direction-optimizing BFS switches to bottom-up
+        TestGraph graph = randomGraph(rng, 20000, 300000, 1, 1);
+        for (int source : { 0, 123 }) {
+            std::vector<int> expected = referenceBFS(graph, source);
+            BreadthFirstSearch::Result result = graph.tool.breadthFirstSearch(externalId(source));
+            CHECK(result.depth == expected);
+            CHECK(graph.tool.hopDistances(externalId(source)) == expected);
+            for (int v = 0; v < graph.n; v++) {
+                if (v == source || expected[v] < 0) continue;
+                int parent = result.parent[v];
+                CHECK(parent >= 0 && expected[parent] + 1 == expected[v]);
+            }
+        }
+    }
+
+    void testMultiSourceBFS() {
+        std::mt19937 rng(18);
+        // More sources than one 64-wide batch
+        TestGraph graph = randomGraph(rng, 3000, 4500, 1, 1);
+        std::vector<NodeId> sources;
+        for (int i = 0; i < 70; i++) sources.push_back(externalId(static_cast<int>(rng() % graph.n)));
+        GraphAnalysisTool::DistanceMatrix matrix = graph.tool.multiSourceHopDistances(sources);
+        CHECK(matrix.rows == sources.size() && matrix.columns == static_cast<size_t>(graph.n));
+        for (size_t i = 0; i < sources.size(); i++) {
+            std::vector<int> expected = referenceBFS(graph, localIndex(sources[i]));
+            for (int v = 0; v < graph.n; v++) {
+                CHECK(matrix.at(i, v) == expected[v]);
+            }
+        }
+        CHECK(graph.tool.multiSourceHopDistances({ 5 }).distances == std::vector<int>(graph.n, -1));
+    }
+
+    void testKShortestPaths() {
+        std::mt19937 rng(19);
+        for (int trial = 0; trial < 10; trial++) {
+            // No parallel edges, so every path has exactly one weight
+            TestGraph graph(10);
+            std::set<std::pair<int, int>> used;
+            while (used.size() < 35) {
+                int a = static_cast<int>(rng() % graph.n);
+                int b = static_cast<int>(rng() % graph.n);
+                if (a != b && used.insert({ a, b }).second) {
+                    graph.addEdge(a, b, static_cast<int>(rng() % 9) + 1);
+                }
+            }
+            const int from = 0;
+            const int to = graph.n - 1;
+
+            // Every loopless path by depth-first enumeration
+            std::vector<int> weights;
+            std::vector<char> onPath(graph.n, 0);
+            std::function<void(int, int)> enumerate = [&](int v, int weight) {
+                if (v == to) {
+                    weights.push_back(weight);
+                    return;
+                }
+                onPath[v] = 1;
+                for (const auto& [target, edgeWeight] : graph.out[v]) {
+                    if (!onPath[target]) enumerate(target, weight + edgeWeight);
+                }
+                onPath[v] = 0;
+            };
+            enumerate(from, 0);
+            std::sort(weights.begin(), weights.end());
+
+            const size_t k = 8;
+            auto paths = graph.tool.kShortestPaths(externalId(from), externalId(to), k);
+            CHECK(paths.size() == std::min(k, weights.size()));
+            std::set<std::vector<NodeId>> distinct;
+            for (size_t i = 0; i < paths.size(); i++) {
+                const auto& [path, distance] = paths[i];
+                CHECK(distance == weights[i]);
+                CHECK(distinct.insert(path).second);
+                CHECK(std::set<NodeId>(path.begin(), path.end()).size() == path.size());
+                CHECK(validPath(graph, path, from, to, distance));
+            }
+        }
+    }
+
+    void testReachability() {
+        std::mt19937 rng(20);
+        TestGraph graph = randomGraph(rng, 400, 520, 1, 1);
+        for (int from = 0; from < graph.n; from += 7) {
+            std::vector<int> depth = referenceBFS(graph, from);
+            for (int to = 0; to < graph.n; to++) {
+                CHECK(graph.tool.reachable(externalId(from), externalId(to)) == (depth[to] >= 0));
+            }
+        }
+        CHECK(!graph.tool.reachable(externalId(0), 5));
+    }
+
+    void testConnectedComponents() {
+        std::mt19937 rng(21);
+        // Sequential labeling, then Afforest above its threshold
+        for (int n : { 500, 1 << 17 }) {
+            TestGraph graph = randomGraph(rng, n, n / 2, 1, 1);
+            int count = 0;
+            std::vector<int> expected = referenceWeakComponents(graph, count);
+            ConnectedComponents::Result components = graph.tool.connectedComponents();
+            CHECK(components.count == count);
+            CHECK(samePartition(components.component, expected));
+        }
+    }
+
+    void testStronglyConnected() {
+        std::mt19937 rng(22);
+        // Small graphs take Tarjan, large ones forward-backward
+        for (int n : { 300, 1 << 17 }) {
+            TestGraph graph = randomGraph(rng, n, n + n / 10, 1, 1);
+            StronglyConnectedComponents::Result result = graph.tool.stronglyConnectedComponents();
+            std::vector<int> expected = referenceSCC(graph);
+            CHECK(samePartition(result.component, expected));
+            CHECK(result.count == *std::max_element(expected.begin(), expected.end()) + 1);
+        }
+    }
+
+    // Dense groups of groupSize nodes joined into a ring by single bridges;
+    // planted receives each node's group
+    TestGraph plantedGroups(int groups, int groupSize, std::vector<int>& planted) {
+        TestGraph graph(groups * groupSize);
+        for (int g = 0; g < groups; g++) {
+            for (int i = 0; i < groupSize; i++) {
+                for (int j = 0; j < groupSize; j++) {
+                    if (i != j) graph.addEdge(g * groupSize + i, g * groupSize + j, 1);
+                }
+            }
+            graph.addEdge(g * groupSize, ((g + 1) % groups) * groupSize + 1, 1);
+        }
+        planted.resize(graph.n);
+        for (int v = 0; v < graph.n; v++) planted[v] = v / groupSize;
+        return graph;
+    }
+
+    void testLouvain() {
+        std::vector<int> planted;
+        TestGraph graph = plantedGroups(6, 12, planted);
+        Louvain::Result louvain = graph.tool.louvainCommunities();
+        CHECK(louvain.count == 6);
+        CHECK(samePartition(louvain.community, planted));
+        CHECK(louvain.modularity > 0.7);
+    }
+
+    void testLabelPropagation() {
+        std::vector<int> planted;
+        TestGraph graph = plantedGroups(6, 12, planted);
+        CHECK(samePartition(graph.tool.labelPropagationCommunities(), planted));
+        CHECK(graph.tool.labelPropagationCommunity(5) == -1);
+
+        // Nodes added after the first run join as their own community
+        graph.tool.addNode(5);
+        std::vector<int> labels = graph.tool.labelPropagationCommunities();
+        CHECK(labels.size() == graph.tool.getNodes().size());
+        CHECK(graph.tool.labelPropagationCommunity(5) == labels.back());
+        CHECK(std::count(labels.begin(), labels.end(), labels.back()) == 1);
+    }
+
+    void testLiveConnectivity() {
+        std::mt19937 rng(25);
+        for (int n : { 500, 1 << 15 }) {
+            TestGraph graph(n);
+            graph.tool.trackConnectivity();
+            for (int round = 0; round < 4; round++) {
+                std::vector<GraphAnalysisTool::Edge> batch;
+                for (int i = 0; i < n / 5; i++) {
+                    int from = static_cast<int>(rng() % n);
+                    int to = static_cast<int>(rng() % n);
+                    if (i % 2 == 0) {
+                        graph.addEdge(from, to, 1);
+                    }
+                    else {
+                        graph.out[from].push_back({ to, 1 });
+                        batch.push_back({ externalId(from), externalId(to), 1 });
+                    }
+                }
+                graph.tool.addEdges(batch);
+
+                int count = 0;
+                std::vector<int> expected = referenceWeakComponents(graph, count);
+                std::vector<int> sizes(count, 0);
+                for (int c : expected) sizes[c]++;
+                CHECK(graph.tool.componentCount() == count);
+                for (int q = 0; q < 200; q++) {
+                    int u = static_cast<int>(rng() % n);
+                    int v = static_cast<int>(rng() % n);
+                    CHECK(graph.tool.connected(externalId(u), externalId(v)) == (expected[u] == expected[v]));
+                    CHECK(graph.tool.componentSize(externalId(u)) == sizes[expected[u]]);
+                }
+            }
+        }
+        TestGraph empty(3);
+        CHECK(!empty.tool.connected(externalId(0), 5));
+        CHECK(empty.tool.componentSize(5) == 0);
+        empty.tool.addNode(5);
+        CHECK(empty.tool.componentCount() == 4 && empty.tool.componentSize(5) == 1);
+    }
+
+    struct TestCase {
+        const char* name;
+        void (*run)();
+    };
+}
+
+int main() {
+    // Enough workers for the parallel code paths even on a single core
+    ParallelExecutor::setThreadCount(4);
+
+    const TestCase tests[] = {
+        { "CSR snapshot", testCsrSnapshot },
+        { "ID mapping", testIdMapping },
+        { "reverse adjacency and isolated nodes", testReverseAdjacency },
+        { "bulk ingestion", testBulkIngestion },
+        { "binary persistence", testBinaryPersistence },
+        { "edge list loader", testEdgeListLoader },
+        { "Dijkstra", testDijkstra },
+        { "bidirectional Dijkstra", testBidirectional },
+        { "ALT", testALT },
+        { "contraction hierarchy", testContractionHierarchy },
+        { "delta-stepping", testDeltaStepping },
+        { "small integer weights", testSmallIntegerWeights },
+        { "distance matrix", testDistanceMatrix },
+        { "all-pairs shortest paths", testAllPairs },
+        { "path cache", testPathCache },
+        { "incremental shortest paths", testDynamicShortestPaths },
+        { "breadth-first search", testBreadthFirstSearch },
+        { "multi-source BFS", testMultiSourceBFS },
+        { "k shortest paths", testKShortestPaths },
+        { "reachability", testReachability },
+        { "connected components", testConnectedComponents },
+        { "strongly connected components", testStronglyConnected },
+        { "Louvain", testLouvain },
+        { "label propagation", testLabelPropagation },
+        { "live connectivity", testLiveConnectivity },
+    };
+
+    for (const TestCase& test : tests) {
+        testFailures = 0;
+        try {
+            test.run();
+        }
+        catch (const std::exception& e) {
+            std::cout << "    unexpected exception: " << e.what() << "\n";
+            testFailures++;
+        }
+        std::cout << (testFailures == 0 ? "[PASS] " : "[FAIL] ") << test.name << "\n";
+        failures += testFailures;
+    }
+    std::cout << (failures == 0 ? "All tests passed" : "Some tests failed") << "\n";
+    return failures == 0 ? 0 : 1;
+}